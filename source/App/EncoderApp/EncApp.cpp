@@ -163,6 +163,9 @@ void EncApp::xInitLibCfg()
   m_cEncLib.setBipredSearchRange                                 ( m_bipredSearchRange );
   m_cEncLib.setClipForBiPredMeEnabled                            ( m_bClipForBiPredMeEnabled );
   m_cEncLib.setFastMEAssumingSmootherMVEnabled                   ( m_bFastMEAssumingSmootherMVEnabled );
+  m_cEncLib.setUseTemporalMvSeeds                                ( m_temporalMvSeeds );
+  m_cEncLib.setUseGlobalMotionEstimation                         ( m_globalMotionEstimation );
+  m_cEncLib.setRefSubPelCache                                    ( m_refSubPelCache );
   m_cEncLib.setMinSearchWindow                                   ( m_minSearchWindow );
   m_cEncLib.setRestrictMESampling                                ( m_bRestrictMESampling );
 
@@ -202,6 +205,7 @@ void EncApp::xInitLibCfg()
   m_cEncLib.setDeltaQpRD                                         ( m_uiDeltaQpRD  );
 #endif
   m_cEncLib.setFastDeltaQp                                       ( m_bFastDeltaQP  );
+  m_cEncLib.setUseCrossQpReuse                                   ( m_crossQpReuse  );
   m_cEncLib.setUseASR                                            ( m_bUseASR      );
   m_cEncLib.setUseHADME                                          ( m_bUseHADME    );
   m_cEncLib.setdQPs                                              ( m_aidQP        );
@@ -256,10 +260,15 @@ void EncApp::xInitLibCfg()
   m_cEncLib.setUseCbfFastMode                                    ( m_bUseCbfFastMode  );
   m_cEncLib.setUseEarlySkipDetection                             ( m_useEarlySkipDetection );
   m_cEncLib.setUseFastMerge                                      ( m_useFastMrg );
+  m_cEncLib.setUseMergePredCache                                 ( m_mergePredCache );
+  m_cEncLib.setUseMergeSatdSkip                                  ( m_mergeSatdSkip );
   m_cEncLib.setUsePbIntraFast                                    ( m_usePbIntraFast );
   m_cEncLib.setUseAMaxBT                                         ( m_useAMaxBT );
   m_cEncLib.setUseE0023FastEnc                                   ( m_e0023FastEnc );
   m_cEncLib.setUseContentBasedFastQtbt                           ( m_contentBasedFastQtbt );
+  m_cEncLib.setUseSplitPredictor                                 ( m_splitPredictor );
+  m_cEncLib.setSplitPredictorThreshold                           ( m_splitPredictorThreshold );
+  m_cEncLib.setSplitPredictorDumpFile                            ( m_splitPredictorDumpFile );
   m_cEncLib.setCrossComponentPredictionEnabledFlag               ( m_crossComponentPredictionEnabledFlag );
   m_cEncLib.setUseReconBasedCrossCPredictionEstimate             ( m_reconBasedCrossCPredictionEstimate );
   m_cEncLib.setLog2SaoOffsetScale                                ( CHANNEL_TYPE_LUMA  , m_log2SaoOffsetScale[CHANNEL_TYPE_LUMA]   );
@@ -277,6 +286,7 @@ void EncApp::xInitLibCfg()
   }
   m_cEncLib.setUseConstrainedIntraPred                           ( m_bUseConstrainedIntraPred );
   m_cEncLib.setFastUDIUseMPMEnabled                              ( m_bFastUDIUseMPMEnabled );
+  m_cEncLib.setUseIntraSatdCache                                 ( m_intraSatdCache );
   m_cEncLib.setFastMEForGenBLowDelayEnabled                      ( m_bFastMEForGenBLowDelayEnabled );
   m_cEncLib.setUseBLambdaForNonKeyLowDelayPictures               ( m_bUseBLambdaForNonKeyLowDelayPictures );
   m_cEncLib.setPCMLog2MinSize                                    ( m_uiPCMLog2MinSize);
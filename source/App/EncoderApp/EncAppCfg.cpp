@@ -848,10 +848,15 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
 
   ("LCTUFast",                                        m_useFastLCTU,                                    false, "Fast methods for large CTU")
   ("FastMrg",                                         m_useFastMrg,                                     false, "Fast methods for inter merge")
+  ("MergePredCache",                                  m_mergePredCache,                                  true, "Reuse the prediction samples of merge candidates already motion compensated for a covering block")
+  ("MergeSatdSkip",                                   m_mergeSatdSkip,                                  false, "Stop the CU mode search after merge when the SATD of the best candidate is below the online trained skip threshold")
   ("PBIntraFast",                                     m_usePbIntraFast,                                 false, "Fast assertion if the intra mode is probable")
   ("AMaxBT",                                          m_useAMaxBT,                                      false, "Adaptive maximal BT-size")
   ("E0023FastEnc",                                    m_e0023FastEnc,                                    true, "Fast encoding setting for QTBT (proposal E0023)")
   ("ContentBasedFastQtbt",                            m_contentBasedFastQtbt,                           false, "Signal based QTBT speed-up")
+  ("SplitPredictor",                                  m_splitPredictor,                                 false, "Skip CU splits that the learned split predictor considers unlikely")
+  ("SplitPredictorThreshold",                         m_splitPredictorThreshold,                           40, "Minimum predicted probability (per mille) of a split to be tested")
+  ("SplitPredictorDumpFile",                          m_splitPredictorDumpFile,                      string(), "File to append split predictor training samples to. If empty, no samples are written")
   // Unit definition parameters
   ("MaxCUWidth",                                      m_uiMaxCUWidth,                                     64u)
   ("MaxCUHeight",                                     m_uiMaxCUHeight,                                    64u)
@@ -883,6 +888,9 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
   ("RestrictMESampling",                              m_bRestrictMESampling,                            false, "Restrict ME Sampling for selective inter motion search")
   ("ClipForBiPredMEEnabled",                          m_bClipForBiPredMeEnabled,                        false, "Enables clipping in the Bi-Pred ME. It is disabled to reduce encoder run-time")
   ("FastMEAssumingSmootherMVEnabled",                 m_bFastMEAssumingSmootherMVEnabled,                true, "Enables fast ME assuming a smoother MV.")
+  ("TemporalMvSeeds",                                 m_temporalMvSeeds,                                false, "Start the TZ search also from the scaled motion of previously coded pictures and narrow it when they predict well")
+  ("GlobalMotionEstimation",                          m_globalMotionEstimation,                         false, "Estimate an affine camera motion per reference picture, used as start point of the TZ and affine search and to align the pictures for the WP decision")
+  ("RefSubPelCache",                                  m_refSubPelCache,                                     1, "Sub-sample planes of the reference pictures shared by the fractional ME (0:off, 1:half-sample, per CTU-sized tile on first use, 2:half-sample, on first reference, 3:all phases, on first reference)")
 
   ("HadamardME",                                      m_bUseHADME,                                       true, "Hadamard ME for fractional-pel")
   ("ASR",                                             m_bUseASR,                                        false, "Adaptive motion search range");
@@ -915,6 +923,7 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
   ("MaxCuDQPDepth,-dqd",                              m_iMaxCuDQPDepth,                                     0, "max depth for a minimum CuDQP")
   ("MaxCUChromaQpAdjustmentDepth",                    m_diffCuChromaQpOffsetDepth,                         -1, "Maximum depth for CU chroma Qp adjustment - set less than 0 to disable")
   ("FastDeltaQP",                                     m_bFastDeltaQP,                                   false, "Fast Delta QP Algorithm")
+  ("CrossQPReuse",                                    m_crossQpReuse,                                   false, "Start the integer ME of the DeltaQpRD / MaxDeltaQP loops from the vectors of another QP pass (approximate)")
 #if SHARP_LUMA_DELTA_QP
   ("LumaLevelToDeltaQPMode",                          lumaLevelToDeltaQPMode,                              0u, "Luma based Delta QP 0(default): not used. 1: Based on CTU average, 2: Based on Max luma in CTU")
 #if !WCG_EXT
@@ -1012,6 +1021,7 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
 
   ("ConstrainedIntraPred",                            m_bUseConstrainedIntraPred,                       false, "Constrained Intra Prediction")
   ("FastUDIUseMPMEnabled",                            m_bFastUDIUseMPMEnabled,                           true, "If enabled, adapt intra direction search, accounting for MPM")
+  ("IntraSatdCache",                                  m_intraSatdCache,                                  true, "Reuse the intra mode SATD costs of a block revisited with unchanged reference samples")
   ("FastMEForGenBLowDelayEnabled",                    m_bFastMEForGenBLowDelayEnabled,                   true, "If enabled use a fast ME for generalised B Low Delay slices")
   ("UseBLambdaForNonKeyLowDelayPictures",             m_bUseBLambdaForNonKeyLowDelayPictures,            true, "Enables use of B-Lambda for non-key low-delay pictures")
   ("PCMEnabledFlag",                                  m_usePCM,                                         false)
@@ -2213,6 +2223,11 @@ bool EncAppCfg::xCheckParameter()
   }
   xConfirmPara( m_uiMaxCUDepth > MAX_CU_DEPTH,                                              "MaxPartitionDepth exceeds predefined MAX_CU_DEPTH limit");
   xConfirmPara( m_uiMaxCUWidth > MAX_CU_SIZE,                                               "MaxCUWith exceeds predefined MAX_CU_SIZE limit");
+  xConfirmPara( m_splitPredictor && !m_QTBT,                                                "SplitPredictor requires QTBT");
+  xConfirmPara( m_mergeSatdSkip && !m_useFastMrg,                                           "MergeSatdSkip requires FastMrg");
+  xConfirmPara( m_refSubPelCache < 0 || m_refSubPelCache > 3,                               "RefSubPelCache must be in the range of 0 to 3");
+  xConfirmPara( m_refSubPelCache && ( m_numSplitThreads > 1 || m_numWppThreads > 1 ),       "RefSubPelCache fills its tiles on demand and does not support NumSplitThreads or NumWppThreads larger than 1");
+  xConfirmPara( m_splitPredictorThreshold < 0 || m_splitPredictorThreshold > 1000,         "SplitPredictorThreshold must be in the range of 0 to 1000");
 
   xConfirmPara( m_uiMinQT[0] < 1<<MIN_CU_LOG2,                                              "Minimum QT size should be larger than or equal to 4");
   xConfirmPara( m_uiMinQT[1] < 1<<MIN_CU_LOG2,                                              "Minimum QT size should be larger than or equal to 4");
@@ -3026,12 +3041,17 @@ void EncAppCfg::xPrintParameter()
   msg( VERBOSE, "LQP:%d ", m_lumaLevelToDeltaQPMapping.mode     );
 #endif
   msg( VERBOSE, "SQP:%d ", m_uiDeltaQpRD                        );
+  if( m_uiDeltaQpRD > 0 || m_iMaxDeltaQP > 0 ) msg( VERBOSE, "CrossQPReuse:%d ", m_crossQpReuse );
   msg( VERBOSE, "ASR:%d ", m_bUseASR                            );
   msg( VERBOSE, "MinSearchWindow:%d ", m_minSearchWindow        );
   msg( VERBOSE, "RestrictMESampling:%d ", m_bRestrictMESampling );
+  msg( VERBOSE, "TemporalMvSeeds:%d ", m_temporalMvSeeds        );
+  msg( VERBOSE, "GME:%d ", m_globalMotionEstimation             );
+  msg( VERBOSE, "RefSubPelCache:%d ", m_refSubPelCache          );
   msg( VERBOSE, "FEN:%d ", int(m_fastInterSearchMode)           );
   msg( VERBOSE, "ECU:%d ", m_bUseEarlyCU                        );
   msg( VERBOSE, "FDM:%d ", m_useFastDecisionForMerge            );
+  msg( VERBOSE, "ISC:%d ", m_intraSatdCache                     );
   msg( VERBOSE, "CFM:%d ", m_bUseCbfFastMode                    );
   msg( VERBOSE, "ESD:%d ", m_useEarlySkipDetection              );
   msg( VERBOSE, "RQT:%d ", !m_QTBT                              );
@@ -3120,12 +3140,16 @@ void EncAppCfg::xPrintParameter()
     msg( VERBOSE, "LCTUFast:%d ", m_useFastLCTU );
   }
   msg( VERBOSE, "FastMrg:%d ", m_useFastMrg );
+  msg( VERBOSE, "MergePredCache:%d ", m_mergePredCache );
+  if( m_useFastMrg ) msg( VERBOSE, "MergeSatdSkip:%d ", m_mergeSatdSkip );
   msg( VERBOSE, "PBIntraFast:%d ", m_usePbIntraFast );
   if( m_ImvMode == 2 ) msg( VERBOSE, "IMV4PelFast:%d ", m_Imv4PelFast );
   if( m_EMT ) msg( VERBOSE, "EMTFast: %1d(intra) %1d(inter) ", ( m_FastEMT & m_EMT & 1 ), ( m_FastEMT >> 1 ) & ( m_EMT >> 1 ) & 1 );
   if( m_QTBT ) msg( VERBOSE, "AMaxBT:%d ", m_useAMaxBT );
   if( m_QTBT ) msg( VERBOSE, "E0023FastEnc:%d ", m_e0023FastEnc );
   if( m_QTBT ) msg( VERBOSE, "ContentBasedFastQtbt:%d ", m_contentBasedFastQtbt );
+  if( m_QTBT ) msg( VERBOSE, "SplitPredictor:%d ", m_splitPredictor );
+  if( m_splitPredictor ) msg( VERBOSE, "SplitPredictorThreshold:%d ", m_splitPredictorThreshold );
 
   msg( VERBOSE, "NumSplitThreads:%d ", m_numSplitThreads );
   if( m_numSplitThreads > 1 )
@@ -170,6 +170,7 @@ protected:
   int       m_iMaxCuDQPDepth;                                 ///< Max. depth for a minimum CuDQPSize (0:default)
   int       m_diffCuChromaQpOffsetDepth;                      ///< If negative, then do not apply chroma qp offsets.
   bool      m_bFastDeltaQP;                                   ///< Fast Delta QP (false:default)
+  bool      m_crossQpReuse;                                   ///< reuse QP independent analysis across the multiple-QP loops (false:default)
 
   int       m_cbQpOffset;                                     ///< Chroma Cb QP Offset (0:default)
   int       m_crQpOffset;                                     ///< Chroma Cr QP Offset (0:default)
@@ -233,8 +234,13 @@ protected:
   bool      m_usePbIntraFast;
   bool      m_useAMaxBT;
   bool      m_useFastMrg;
+  bool      m_mergePredCache;
+  bool      m_mergeSatdSkip;
   bool      m_e0023FastEnc;
   bool      m_contentBasedFastQtbt;
+  bool      m_splitPredictor;
+  int       m_splitPredictorThreshold;
+  std::string m_splitPredictorDumpFile;
 
 
   int       m_numSplitThreads;
@@ -309,6 +315,9 @@ protected:
   int       m_minSearchWindow;                                ///< ME minimum search window size for the Adaptive Window ME
   bool      m_bClipForBiPredMeEnabled;                        ///< Enables clipping for Bi-Pred ME.
   bool      m_bFastMEAssumingSmootherMVEnabled;               ///< Enables fast ME assuming a smoother MV.
+  bool      m_temporalMvSeeds;                                ///< seed the ME with the motion of previously coded pictures
+  bool      m_globalMotionEstimation;                         ///< picture level global motion for seeding the ME and the WP decision
+  int       m_refSubPelCache;                                 ///< sub-sample planes of the reference pictures for the fractional ME
   FastInterSearchMode m_fastInterSearchMode;                  ///< Parameter that controls fast encoder settings
   bool      m_bUseEarlyCU;                                    ///< flag for using Early CU setting
   bool      m_useFastDecisionForMerge;                        ///< flag for using Fast Decision Merge RD-Cost
@@ -334,6 +343,7 @@ protected:
 
   bool      m_bUseConstrainedIntraPred;                       ///< flag for using constrained intra prediction
   bool      m_bFastUDIUseMPMEnabled;
+  bool      m_intraSatdCache;                                 ///< reuse intra SATD costs of blocks with unchanged reference samples
   bool      m_bFastMEForGenBLowDelayEnabled;
   bool      m_bUseBLambdaForNonKeyLowDelayPictures;
 
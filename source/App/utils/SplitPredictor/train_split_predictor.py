@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+#
+# Trains the decision forest of the encoder's learned split predictor (EncSplitPredictor.cpp).
+#
+# Collect samples by encoding representative content with "--SplitPredictorDumpFile=samples.txt" (and the
+# predictor itself disabled), then run
+#
+#   train_split_predictor.py samples.txt [more_samples.txt ...] > tables.inc
+#
+# and replace the part between //TABLES_BEGIN and //TABLES_END of EncSplitPredictor.cpp with the output.
+# Each sample line holds the features in SplitPredFeature order followed by the SplitPredClass label.
+# Only the python standard library is needed.
+
+import argparse
+import random
+import sys
+
+NUM_CLASSES = 6
+
+
+def load( files ):
+  samples = []
+  for name in files:
+    with open( name ) as f:
+      for line in f:
+        v = [int( x ) for x in line.split()]
+        if v:
+          samples.append( ( v[:-1], v[-1], 1 << ( v[0] + v[1] - 4 ) ) )
+  return samples
+
+
+def histogram( samples ):
+  # samples are weighted by their area, a wrong decision for a large block costs more
+  h = [0] * NUM_CLASSES
+  for _, c, w in samples:
+    h[c] += w
+  return h
+
+
+def gini( h, n ):
+  return 1.0 - sum( ( x / n ) ** 2 for x in h ) if n else 0.0
+
+
+def best_split( samples, min_leaf ):
+  n        = sum( histogram( samples ) )
+  total    = histogram( samples )
+  best     = None
+  bestGain = 1e-6
+  parent   = gini( total, n )
+  for feat in range( len( samples[0][0] ) ):
+    # the features are small integers, so the candidate thresholds are found from per value class counts
+    counts = {}
+    num    = {}
+    for f, c, w in samples:
+      counts.setdefault( f[feat], [0] * NUM_CLASSES )[c] += w
+      num[f[feat]] = num.get( f[feat], 0 ) + 1
+    left = [0] * NUM_CLASSES
+    nl   = 0
+    cnt  = 0
+    for val in sorted( counts )[:-1]:
+      left = [l + x for l, x in zip( left, counts[val] )]
+      nl  += sum( counts[val] )
+      cnt += num[val]
+      if cnt < min_leaf or len( samples ) - cnt < min_leaf:
+        continue
+      right = [t - l for t, l in zip( total, left )]
+      gain  = parent - ( nl * gini( left, nl ) + ( n - nl ) * gini( right, n - nl ) ) / n
+      if gain > bestGain:
+        bestGain = gain
+        best     = ( feat, val )
+  return best
+
+
+def grow( samples, depth, args, nodes, leaves ):
+  idx = len( nodes )
+  nodes.append( None )
+  split = best_split( samples, args.min_leaf ) if depth < args.depth else None
+  if split is None:
+    h = histogram( samples )
+    n = sum( h )
+    leaves.append( [( 1000 * x + n // 2 ) // n for x in h] )
+    nodes[idx] = ( -1, 0, len( leaves ) - 1, 0 )
+    return idx
+  feat, thr = split
+  left  = grow( [s for s in samples if s[0][feat] <= thr], depth + 1, args, nodes, leaves )
+  right = grow( [s for s in samples if s[0][feat] >  thr], depth + 1, args, nodes, leaves )
+  nodes[idx] = ( feat, thr, left, right )
+  return idx
+
+
+def main():
+  parser = argparse.ArgumentParser( description='train the split predictor decision forest' )
+  parser.add_argument( 'samples', nargs='+' )
+  parser.add_argument( '--trees',    type=int, default=4 )
+  parser.add_argument( '--depth',    type=int, default=7 )
+  parser.add_argument( '--min-leaf', type=int, default=200 )
+  parser.add_argument( '--bagging',  type=float, default=0.6, help='fraction of the samples used per tree' )
+  parser.add_argument( '--seed',     type=int, default=1 )
+  args = parser.parse_args()
+
+  samples = load( args.samples )
+  rnd     = random.Random( args.seed )
+  nodes, leaves, roots = [], [], []
+  for t in range( args.trees ):
+    bag = samples if args.trees == 1 else rnd.sample( samples, int( len( samples ) * args.bagging ) )
+    roots.append( grow( bag, 0, args, nodes, leaves ) )
+
+  out = sys.stdout
+  out.write( '//TABLES_BEGIN\n' )
+  out.write( '// %d samples, area weighted class histogram %s\n' % ( len( samples ), histogram( samples ) ) )
+  out.write( 'static constexpr int NUM_SPLIT_PRED_TREES = %d;\n\n' % args.trees )
+  out.write( 'static constexpr uint16_t g_splitPredRoots[NUM_SPLIT_PRED_TREES] = { %s };\n\n' % ', '.join( str( r ) for r in roots ) )
+  out.write( 'static constexpr SplitPredNode g_splitPredNodes[] =\n{\n' )
+  for feat, thr, left, right in nodes:
+    out.write( '  { %2d, %4d, %4d, %4d },\n' % ( feat, thr, left, right ) )
+  out.write( '};\n\n' )
+  out.write( '// class distributions of the leaves in per mille\n' )
+  out.write( 'static constexpr uint16_t g_splitPredLeaves[][NUM_SPLIT_PRED_CLASSES] =\n{\n' )
+  for leaf in leaves:
+    out.write( '  { %s },\n' % ', '.join( '%4d' % p for p in leaf ) )
+  out.write( '};\n' )
+  out.write( '//TABLES_END\n' )
+
+
+if __name__ == '__main__':
+  main()
@@ -79,6 +79,43 @@ void reconstructCore( const T* src1, int src1Stride, const T* src2, int src2Stri
 }
 
 
+template<typename T>
+void subtractCore( const T* src0, int src0Stride, const T* src1, int src1Stride, T* dest, int dstStride, int width, int height )
+{
+#define SUBS_CORE_OP( ADDR ) dest[ADDR] = src0[ADDR] - src1[ADDR]
+#define SUBS_CORE_INC     \
+  src0 += src0Stride;     \
+  src1 += src1Stride;     \
+  dest +=  dstStride;     \
+
+  SIZE_AWARE_PER_EL_OP( SUBS_CORE_OP, SUBS_CORE_INC );
+
+#undef SUBS_CORE_OP
+#undef SUBS_CORE_INC
+}
+
+
+template<typename T>
+Distortion reconstructSSECore( const T* src1, int src1Stride, const T* src2, int src2Stride, T* dest, int dstStride, const T* org, int orgStride, int width, int height, const ClpRng& clpRng )
+{
+  Distortion sum = 0;
+
+#define RECO_SSE_CORE_OP( ADDR ) { dest[ADDR] = ClipPel( src1[ADDR] + src2[ADDR], clpRng ); const Intermediate_Int diff = org[ADDR] - dest[ADDR]; sum += Distortion( diff * diff ); }
+#define RECO_SSE_CORE_INC \
+  src1 += src1Stride;     \
+  src2 += src2Stride;     \
+  dest +=  dstStride;     \
+  org  +=  orgStride;     \
+
+  SIZE_AWARE_PER_EL_OP( RECO_SSE_CORE_OP, RECO_SSE_CORE_INC );
+
+#undef RECO_SSE_CORE_OP
+#undef RECO_SSE_CORE_INC
+
+  return sum;
+}
+
+
 template<typename T>
 void linTfCore( const T* src, int srcStride, Pel *dst, int dstStride, int width, int height, int scale, int shift, int offset, const ClpRng& clpRng, bool bClip )
 {
@@ -93,6 +130,36 @@ void linTfCore( const T* src, int srcStride, Pel *dst, int dstStride, int width,
 #undef LINTF_CORE_INC
 }
 
+template<typename T>
+void wghtAvgCore( const T* src0, int src0Stride, const T* src1, int src1Stride, T* dest, int dstStride, int width, int height, int w0, int w1, int shift, int offset, const ClpRng& clpRng )
+{
+#define WGHT_AVG_CORE_OP( ADDR ) dest[ADDR] = ClipPel( ( w0 * src0[ADDR] + w1 * src1[ADDR] + offset ) >> shift, clpRng )
+#define WGHT_AVG_CORE_INC \
+  src0 += src0Stride;     \
+  src1 += src1Stride;     \
+  dest +=  dstStride;     \
+
+  SIZE_AWARE_PER_EL_OP( WGHT_AVG_CORE_OP, WGHT_AVG_CORE_INC );
+
+#undef WGHT_AVG_CORE_OP
+#undef WGHT_AVG_CORE_INC
+}
+
+
+template<typename T>
+void wghtUniCore( const T* src0, int src0Stride, T* dest, int dstStride, int width, int height, int w0, int shift, int round, int offset, const ClpRng& clpRng )
+{
+#define WGHT_UNI_CORE_OP( ADDR ) dest[ADDR] = ClipPel( ( ( w0 * src0[ADDR] + round ) >> shift ) + offset, clpRng )
+#define WGHT_UNI_CORE_INC \
+  src0 += src0Stride;     \
+  dest +=  dstStride;     \
+
+  SIZE_AWARE_PER_EL_OP( WGHT_UNI_CORE_OP, WGHT_UNI_CORE_INC );
+
+#undef WGHT_UNI_CORE_OP
+#undef WGHT_UNI_CORE_INC
+}
+
 PelBufferOps::PelBufferOps()
 {
   addAvg4 = addAvgCore<Pel>;
@@ -101,8 +168,20 @@ PelBufferOps::PelBufferOps()
   reco4 = reconstructCore<Pel>;
   reco8 = reconstructCore<Pel>;
 
+  sub4 = subtractCore<Pel>;
+  sub8 = subtractCore<Pel>;
+
+  recoSSE4 = reconstructSSECore<Pel>;
+  recoSSE8 = reconstructSSECore<Pel>;
+
   linTf4 = linTfCore<Pel>;
   linTf8 = linTfCore<Pel>;
+
+  wghtAvg4 = wghtAvgCore<Pel>;
+  wghtAvg8 = wghtAvgCore<Pel>;
+
+  wghtUni4 = wghtUniCore<Pel>;
+  wghtUni8 = wghtUniCore<Pel>;
 }
 
 PelBufferOps g_pelBufOP = PelBufferOps();
@@ -258,6 +337,86 @@ void AreaBuf<Pel>::reconstruct( const AreaBuf<const Pel> &pred, const AreaBuf<co
   }
 }
 
+template<>
+Distortion AreaBuf<Pel>::reconstructSSE( const AreaBuf<const Pel> &pred, const AreaBuf<const Pel> &resi, const AreaBuf<const Pel> &org, const ClpRng& clpRng )
+{
+  const Pel* src1 = pred.buf;
+  const Pel* src2 = resi.buf;
+  const Pel* srcO =  org.buf;
+        Pel* dest =      buf;
+
+  const unsigned src1Stride = pred.stride;
+  const unsigned src2Stride = resi.stride;
+  const unsigned srcOStride =  org.stride;
+  const unsigned destStride =      stride;
+
+#if ENABLE_SIMD_OPT_BUFFER && defined(TARGET_SIMD_X86)
+  if( ( width & 7 ) == 0 )
+  {
+    return g_pelBufOP.recoSSE8( src1, src1Stride, src2, src2Stride, dest, destStride, srcO, srcOStride, width, height, clpRng );
+  }
+  else if( ( width & 3 ) == 0 )
+  {
+    return g_pelBufOP.recoSSE4( src1, src1Stride, src2, src2Stride, dest, destStride, srcO, srcOStride, width, height, clpRng );
+  }
+#endif
+
+  Distortion sum = 0;
+
+#define RECO_SSE_OP( ADDR ) { dest[ADDR] = ClipPel( src1[ADDR] + src2[ADDR], clpRng ); const Intermediate_Int diff = srcO[ADDR] - dest[ADDR]; sum += Distortion( diff * diff ); }
+#define RECO_SSE_INC    \
+  src1 += src1Stride;   \
+  src2 += src2Stride;   \
+  srcO += srcOStride;   \
+  dest += destStride;   \
+
+  SIZE_AWARE_PER_EL_OP( RECO_SSE_OP, RECO_SSE_INC );
+
+#undef RECO_SSE_OP
+#undef RECO_SSE_INC
+
+  return sum;
+}
+
+template<>
+void AreaBuf<Pel>::subtract( const AreaBuf<const Pel> &minuend, const AreaBuf<const Pel> &subtrahend )
+{
+  CHECK( width  != minuend.width || width  != subtrahend.width,  "Incompatible size" );
+  CHECK( height != minuend.height || height != subtrahend.height, "Incompatible size" );
+
+  const Pel* src0 =    minuend.buf;
+  const Pel* src1 = subtrahend.buf;
+        Pel* dest =            buf;
+
+  const unsigned src0Stride =    minuend.stride;
+  const unsigned src1Stride = subtrahend.stride;
+  const unsigned destStride =            stride;
+
+#if ENABLE_SIMD_OPT_BUFFER && defined(TARGET_SIMD_X86)
+  if( ( width & 7 ) == 0 )
+  {
+    g_pelBufOP.sub8( src0, src0Stride, src1, src1Stride, dest, destStride, width, height );
+  }
+  else if( ( width & 3 ) == 0 )
+  {
+    g_pelBufOP.sub4( src0, src0Stride, src1, src1Stride, dest, destStride, width, height );
+  }
+  else
+#endif
+  {
+#define SUBS_OP( ADDR ) dest[ADDR] = src0[ADDR] - src1[ADDR]
+#define SUBS_INC        \
+    src0 += src0Stride; \
+    src1 += src1Stride; \
+    dest += destStride; \
+
+    SIZE_AWARE_PER_EL_OP( SUBS_OP, SUBS_INC );
+
+#undef SUBS_OP
+#undef SUBS_INC
+  }
+}
+
 template<>
 void AreaBuf<Pel>::linearTransform( const int scale, const int shift, const int offset, bool bClip, const ClpRng& clpRng )
 {
@@ -302,12 +461,121 @@ void AreaBuf<Pel>::subtract( const Pel val )
 #endif
 
 
+// ---------------------------------------------------------------------------
+// BufferPool class
+// ---------------------------------------------------------------------------
+
+BufferPool g_picBufferPool;
+
+BufferPool::BufferPool()
+{
+  std::fill( m_bytesInUse,     m_bytesInUse     + MAX_NUM_ROLES, 0 );
+  std::fill( m_peakBytesInUse, m_peakBytesInUse + MAX_NUM_ROLES, 0 );
+
+  m_bytesTotal     = 0;
+  m_peakBytesTotal = 0;
+  m_numAllocations = 0;
+  m_numReuses      = 0;
+}
+
+BufferPool::~BufferPool()
+{
+  trim();
+}
+
+void *BufferPool::get( const size_t size, const int role )
+{
+  CHECK( role < 0 || role >= MAX_NUM_ROLES, "Invalid buffer role" );
+
+  std::unique_lock<std::mutex> lock( m_mutex );
+
+  void *buf = nullptr;
+  auto  it  = m_free.find( size );
+
+  if( it != m_free.end() )
+  {
+    buf = it->second;
+    m_free.erase( it );
+    m_numReuses++;
+  }
+  else
+  {
+    buf = xMalloc( char, size );
+    CHECK( !buf, "Failed to allocate a buffer" );
+    m_bytesTotal    += size;
+    m_peakBytesTotal = std::max( m_peakBytesTotal, m_bytesTotal );
+    m_numAllocations++;
+  }
+
+  m_inUse[buf]            = Entry{ size, role };
+  m_bytesInUse    [role] += size;
+  m_peakBytesInUse[role]  = std::max( m_peakBytesInUse[role], m_bytesInUse[role] );
+
+  return buf;
+}
+
+void BufferPool::give( void *buf )
+{
+  if( !buf )
+  {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock( m_mutex );
+
+  auto it = m_inUse.find( buf );
+  CHECK( it == m_inUse.end(), "Returning a buffer not taken from the pool" );
+
+  m_bytesInUse[it->second.role] -= it->second.size;
+  m_free.emplace( it->second.size, buf );
+  m_inUse.erase( it );
+}
+
+void BufferPool::trim()
+{
+  std::unique_lock<std::mutex> lock( m_mutex );
+
+  for( auto &entry : m_free )
+  {
+    m_bytesTotal -= entry.first;
+    xFree( entry.second );
+  }
+  m_free.clear();
+}
+
+void BufferPool::report( const char *const roleNames[], const int numRoles ) const
+{
+  std::unique_lock<std::mutex> lock( m_mutex );
+
+  if( m_numAllocations == 0 )
+  {
+    return;
+  }
+
+  msg( INFO, "\nPicture buffer memory\n" );
+  msg( INFO, "Peak %.2f MB (", m_peakBytesTotal / ( 1024.0 * 1024.0 ) );
+  const char *separator = "";
+  for( int i = 0; i < std::min( numRoles, int( MAX_NUM_ROLES ) ); i++ )
+  {
+    if( m_peakBytesInUse[i] )
+    {
+      msg( INFO, "%s%s %.2f MB", separator, roleNames[i], m_peakBytesInUse[i] / ( 1024.0 * 1024.0 ) );
+      separator = ", ";
+    }
+  }
+  msg( INFO, ")\n" );
+  msg( INFO, "Buffers allocated %llu, reused %llu\n", ( unsigned long long ) m_numAllocations, ( unsigned long long ) m_numReuses );
+}
+
 PelStorage::PelStorage()
 {
   for( uint32_t i = 0; i < MAX_NUM_COMPONENT; i++ )
   {
     m_origin[i] = nullptr;
   }
+
+  m_pool     = nullptr;
+  m_poolRole = 0;
 }
 
 PelStorage::~PelStorage()
@@ -359,7 +627,7 @@ void PelStorage::create( const ChromaFormat &_chromaFormat, const Area& _area, c
     uint32_t area = totalWidth * totalHeight;
     CHECK( !area, "Trying to create a buffer with zero area" );
 
-    m_origin[i] = ( Pel* ) xMalloc( Pel, area );
+    m_origin[i] = m_pool ? ( Pel* ) m_pool->get( sizeof( Pel ) * area, m_poolRole ) : ( Pel* ) xMalloc( Pel, area );
     Pel* topLeft = m_origin[i] + totalWidth * ymargin + xmargin;
     bufs.push_back( PelBuf( topLeft, totalWidth, _area.width >> scaleX, _area.height >> scaleY ) );
   }
@@ -395,6 +663,9 @@ void PelStorage::swap( PelStorage& other )
     std::swap( bufs[i].stride, other.bufs[i].stride );
     std::swap( m_origin[i],    other.m_origin[i] );
   }
+
+  std::swap( m_pool,     other.m_pool );
+  std::swap( m_poolRole, other.m_poolRole );
 }
 
 void PelStorage::destroy()
@@ -404,7 +675,8 @@ void PelStorage::destroy()
   {
     if( m_origin[i] )
     {
-      xFree( m_origin[i] );
+      if( m_pool ) m_pool->give( m_origin[i] );
+      else         xFree( m_origin[i] );
       m_origin[i] = nullptr;
     }
   }
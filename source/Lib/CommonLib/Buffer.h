@@ -46,6 +46,9 @@
 #include <string.h>
 #include <type_traits>
 #include <typeinfo>
+#include <map>
+#include <mutex>
+#include <unordered_map>
 
 // ---------------------------------------------------------------------------
 // AreaBuf struct
@@ -66,8 +69,16 @@ struct PelBufferOps
   void ( *addAvg8 )       ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height,            int shift, int offset, const ClpRng& clpRng );
   void ( *reco4 )         ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height,                                   const ClpRng& clpRng );
   void ( *reco8 )         ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height,                                   const ClpRng& clpRng );
+  void ( *sub4 )          ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height );
+  void ( *sub8 )          ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height );
+  Distortion ( *recoSSE4 )( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, const Pel* org, int orgStride, int width, int height, const ClpRng& clpRng );
+  Distortion ( *recoSSE8 )( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, const Pel* org, int orgStride, int width, int height, const ClpRng& clpRng );
   void ( *linTf4 )        ( const Pel* src0, int src0Stride,                                  Pel *dst, int dstStride, int width, int height, int scale, int shift, int offset, const ClpRng& clpRng, bool bClip );
   void ( *linTf8 )        ( const Pel* src0, int src0Stride,                                  Pel *dst, int dstStride, int width, int height, int scale, int shift, int offset, const ClpRng& clpRng, bool bClip );
+  void ( *wghtAvg4 )      ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, int w0, int w1, int shift, int offset, const ClpRng& clpRng );
+  void ( *wghtAvg8 )      ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, int w0, int w1, int shift, int offset, const ClpRng& clpRng );
+  void ( *wghtUni4 )      ( const Pel* src0, int src0Stride,                                  Pel *dst, int dstStride, int width, int height, int w0,         int shift, int round, int offset, const ClpRng& clpRng );
+  void ( *wghtUni8 )      ( const Pel* src0, int src0Stride,                                  Pel *dst, int dstStride, int width, int height, int w0,         int shift, int round, int offset, const ClpRng& clpRng );
 };
 
 extern PelBufferOps g_pelBufOP;
@@ -97,9 +108,11 @@ struct AreaBuf : public Size
   void copyFrom             ( const AreaBuf<const T> &other );
 
   void reconstruct          ( const AreaBuf<const T> &pred, const AreaBuf<const T> &resi, const ClpRng& clpRng);
+  Distortion reconstructSSE ( const AreaBuf<const T> &pred, const AreaBuf<const T> &resi, const AreaBuf<const T> &org, const ClpRng& clpRng );
   void copyClip             ( const AreaBuf<const T> &src, const ClpRng& clpRng);
 
   void subtract             ( const AreaBuf<const T> &other );
+  void subtract             ( const AreaBuf<const T> &minuend, const AreaBuf<const T> &subtrahend );
   void extendSingleBorderPel();
   void extendBorderPel      (  unsigned margin );
   void addAvg               ( const AreaBuf<const T> &other1, const AreaBuf<const T> &other2, const ClpRng& clpRng );
@@ -140,6 +153,9 @@ typedef AreaBuf<const Pel> CPelBuf;
 typedef AreaBuf<      TCoeff>  CoeffBuf;
 typedef AreaBuf<const TCoeff> CCoeffBuf;
 
+typedef AreaBuf<      TCoeffLevel>  LevelBuf;
+typedef AreaBuf<const TCoeffLevel> CLevelBuf;
+
 typedef AreaBuf<      MotionInfo>  MotionBuf;
 typedef AreaBuf<const MotionInfo> CMotionBuf;
 
@@ -338,6 +354,32 @@ void AreaBuf<T>::subtract( const AreaBuf<const T> &other )
 #undef SUBS_INC
 }
 
+template<typename T>
+void AreaBuf<T>::subtract( const AreaBuf<const T> &minuend, const AreaBuf<const T> &subtrahend )
+{
+  CHECK( width  != minuend.width || width  != subtrahend.width,  "Incompatible size" );
+  CHECK( height != minuend.height || height != subtrahend.height, "Incompatible size" );
+
+        T* dest =            buf;
+  const T* src0 =    minuend.buf;
+  const T* src1 = subtrahend.buf;
+
+#define SUBS_INC             \
+  dest +=            stride; \
+  src0 +=    minuend.stride; \
+  src1 += subtrahend.stride; \
+
+#define SUBS_OP( ADDR ) dest[ADDR] = src0[ADDR] - src1[ADDR]
+
+  SIZE_AWARE_PER_EL_OP( SUBS_OP, SUBS_INC );
+
+#undef SUBS_OP
+#undef SUBS_INC
+}
+
+template<>
+void AreaBuf<Pel>::subtract( const AreaBuf<const Pel> &minuend, const AreaBuf<const Pel> &subtrahend );
+
 template<typename T>
 void AreaBuf<T>::copyClip( const AreaBuf<const T> &src, const ClpRng& clpRng )
 {
@@ -356,6 +398,15 @@ void AreaBuf<T>::reconstruct( const AreaBuf<const T> &pred, const AreaBuf<const
 template<>
 void AreaBuf<Pel>::reconstruct( const AreaBuf<const Pel> &pred, const AreaBuf<const Pel> &resi, const ClpRng& clpRng );
 
+template<typename T>
+Distortion AreaBuf<T>::reconstructSSE( const AreaBuf<const T> &pred, const AreaBuf<const T> &resi, const AreaBuf<const T> &org, const ClpRng& clpRng )
+{
+  THROW( "Type not supported" );
+}
+
+template<>
+Distortion AreaBuf<Pel>::reconstructSSE( const AreaBuf<const Pel> &pred, const AreaBuf<const Pel> &resi, const AreaBuf<const Pel> &org, const ClpRng& clpRng );
+
 
 template<typename T>
 void AreaBuf<T>::addAvg( const AreaBuf<const T> &other1, const AreaBuf<const T> &other2, const ClpRng& clpRng )
@@ -576,6 +627,7 @@ struct UnitBuf
   void reconstruct          ( const UnitBuf<const T> &pred, const UnitBuf<const T> &resi, const ClpRngs& clpRngs );
   void copyClip             ( const UnitBuf<const T> &src, const ClpRngs& clpRngs );
   void subtract             ( const UnitBuf<const T> &other );
+  void subtract             ( const UnitBuf<const T> &minuend, const UnitBuf<const T> &subtrahend );
   void addAvg               ( const UnitBuf<const T> &other1, const UnitBuf<const T> &other2, const ClpRngs& clpRngs, const bool chromaOnly = false, const bool lumaOnly = false);
   void extendSingleBorderPel();
   void extendBorderPel      ( unsigned margin );
@@ -625,6 +677,18 @@ void UnitBuf<T>::subtract( const UnitBuf<const T> &other )
   }
 }
 
+template<typename T>
+void UnitBuf<T>::subtract( const UnitBuf<const T> &minuend, const UnitBuf<const T> &subtrahend )
+{
+  CHECK( chromaFormat != minuend.chromaFormat,    "Incompatible formats" );
+  CHECK( chromaFormat != subtrahend.chromaFormat, "Incompatible formats" );
+
+  for( unsigned i = 0; i < bufs.size(); i++ )
+  {
+    bufs[i].subtract( minuend.bufs[i], subtrahend.bufs[i] );
+  }
+}
+
 template<typename T>
 void UnitBuf<T>::copyClip(const UnitBuf<const T> &src, const ClpRngs& clpRngs)
 {
@@ -725,6 +789,47 @@ const UnitBuf<const T> UnitBuf<T>::subBuf( const UnitArea& subArea ) const
   return subBuf;
 }
 
+// ---------------------------------------------------------------------------
+// BufferPool class (reuses freed large buffers, e.g. picture planes, of equal size)
+// ---------------------------------------------------------------------------
+
+class BufferPool
+{
+public:
+  static const int MAX_NUM_ROLES = 8;
+
+  BufferPool();
+  ~BufferPool();
+
+  void *get ( const size_t size, const int role );
+  void  give( void *buf );
+
+  // frees the buffers not in use
+  void  trim();
+
+  void  report( const char *const roleNames[], const int numRoles ) const;
+
+private:
+  struct Entry
+  {
+    size_t size;
+    int    role;
+  };
+
+  mutable std::mutex                m_mutex;
+  std::unordered_map<void*, Entry>  m_inUse;
+  std::multimap<size_t, void*>      m_free;
+
+  size_t m_bytesInUse    [MAX_NUM_ROLES];
+  size_t m_peakBytesInUse[MAX_NUM_ROLES];
+  size_t m_bytesTotal;
+  size_t m_peakBytesTotal;
+  size_t m_numAllocations;
+  size_t m_numReuses;
+};
+
+extern BufferPool g_picBufferPool;
+
 // ---------------------------------------------------------------------------
 // PelStorage struct (PelUnitBuf which allocates its own memory)
 // ---------------------------------------------------------------------------
@@ -737,6 +842,9 @@ struct PelStorage : public PelUnitBuf
   PelStorage();
   ~PelStorage();
 
+  // take the planes created afterwards from a pool
+  void setPool( BufferPool *pool, const int role ) { m_pool = pool; m_poolRole = role; }
+
   void swap( PelStorage& other );
   void createFromBuf( PelUnitBuf buf );
   void create( const UnitArea &_unit );
@@ -756,6 +864,9 @@ struct PelStorage : public PelUnitBuf
 private:
 
   Pel *m_origin[MAX_NUM_COMPONENT];
+
+  BufferPool *m_pool;
+  int         m_poolRole;
 };
 
 
@@ -54,6 +54,28 @@ const UnitScale UnitScaleArray[NUM_CHROMA_FORMAT][MAX_NUM_COMPONENT] =
   { {2,2}, {2,2}, {2,2} }   // 4:4:4
 };
 
+// calls fill( ptr, stride, width, height, tileIdx ) for the parts of the (scaled, relative) area falling into the tiles of a map
+template<typename T, typename TFill>
+static inline void fillTiled( T *map, const Area &blk, const unsigned log2TileWidth, const unsigned log2TileHeight, const unsigned numTilesX, TFill fill )
+{
+  const int tileWidth  = 1 << log2TileWidth;
+  const int tileHeight = 1 << log2TileHeight;
+
+  for( int y = blk.y; y < blk.y + int( blk.height ); y = ( ( y >> log2TileHeight ) + 1 ) << log2TileHeight )
+  {
+    const int h = std::min<int>( tileHeight - ( y & ( tileHeight - 1 ) ), blk.y + blk.height - y );
+
+    for( int x = blk.x; x < blk.x + int( blk.width ); x = ( ( x >> log2TileWidth ) + 1 ) << log2TileWidth )
+    {
+      const int      w       = std::min<int>( tileWidth - ( x & ( tileWidth - 1 ) ), blk.x + blk.width - x );
+      const unsigned tileIdx = ( y >> log2TileHeight ) * numTilesX + ( x >> log2TileWidth );
+      T             *ptr     = map + ( size_t( tileIdx ) << ( log2TileWidth + log2TileHeight ) ) + ( ( y & ( tileHeight - 1 ) ) << log2TileWidth ) + ( x & ( tileWidth - 1 ) );
+
+      fill( ptr, tileWidth, w, h, tileIdx );
+    }
+  }
+}
+
 // ---------------------------------------------------------------------------
 // coding structure method definitions
 // ---------------------------------------------------------------------------
@@ -81,9 +103,25 @@ CodingStructure::CodingStructure(CUCache& cuCache, PUCache& puCache, TUCache& tu
     m_puIdx   [ i ] = nullptr;
     m_tuIdx   [ i ] = nullptr;
     m_isDecomp[ i ] = nullptr;
+
+    m_cuIdxBase[ i ] = nullptr;
+    m_puIdxBase[ i ] = nullptr;
+    m_tuIdxBase[ i ] = nullptr;
+
+    m_mapNumTiles[ i ] = 0;
+    m_mapSize    [ i ] = 0;
   }
 
-  m_motionBuf     = nullptr;
+  m_numCUs = 0;
+  m_numPUs = 0;
+  m_numTUs = 0;
+
+  m_motionBuf          = nullptr;
+  m_colMotionBuf       = nullptr;
+  m_colMotionSize      = 0;
+  m_colMotionStride    = 0;
+  m_colMotionLog2Scale = 0;
+  m_poolCoeffs         = false;
   features.resize( NUM_ENC_FEATURES );
 
 }
@@ -113,11 +151,27 @@ void CodingStructure::destroy()
 
     delete[] m_tuIdx[ i ];
     m_tuIdx[ i ] = nullptr;
+
+    delete[] m_cuIdxBase[ i ];
+    m_cuIdxBase[ i ] = nullptr;
+
+    delete[] m_puIdxBase[ i ];
+    m_puIdxBase[ i ] = nullptr;
+
+    delete[] m_tuIdxBase[ i ];
+    m_tuIdxBase[ i ] = nullptr;
+
+    m_mapNumTiles[ i ] = 0;
+    m_mapSize    [ i ] = 0;
   }
 
   delete[] m_motionBuf;
   m_motionBuf = nullptr;
 
+  delete[] m_colMotionBuf;
+  m_colMotionBuf  = nullptr;
+  m_colMotionSize = 0;
+
 
   m_tuCache.cache( tus );
   m_puCache.cache( pus );
@@ -135,7 +189,7 @@ bool CodingStructure::isDecomp( const Position &pos, const ChannelType effChType
 {
   if( area.blocks[effChType].contains( pos ) )
   {
-    return m_isDecomp[effChType][rsAddr( pos, area.blocks[effChType], area.blocks[effChType].width, unitScale[effChType] )];
+    return m_isDecomp[effChType][xMapAddr( pos, effChType )];
   }
   else if( parent )
   {
@@ -151,7 +205,7 @@ bool CodingStructure::isDecomp( const Position &pos, const ChannelType effChType
 {
   if( area.blocks[effChType].contains( pos ) )
   {
-    return m_isDecomp[effChType][rsAddr( pos, area.blocks[effChType], area.blocks[effChType].width, unitScale[effChType] )];
+    return m_isDecomp[effChType][xMapAddr( pos, effChType )];
   }
   else if( parent )
   {
@@ -165,13 +219,16 @@ bool CodingStructure::isDecomp( const Position &pos, const ChannelType effChType
 
 void CodingStructure::setDecomp(const CompArea &_area, const bool _isCoded /*= true*/)
 {
-  const UnitScale& scale = unitScale[_area.compID];
+  const UnitScale&  scale  = unitScale[_area.compID];
+  const ChannelType chType = toChannelType( _area.compID );
+  const Position    origin = area.blocks[_area.compID].pos();
+  const Area        blk( ( _area.x - origin.x ) >> scale.posx, ( _area.y - origin.y ) >> scale.posy, _area.width >> scale.posx, _area.height >> scale.posy );
 
-  AreaBuf<bool> isCodedBlk( m_isDecomp[toChannelType( _area.compID )] + rsAddr( _area, area.blocks[_area.compID].pos(), area.blocks[_area.compID].width, scale ),
-                            area.blocks[_area.compID].width >> scale.posx,
-                            _area.width                     >> scale.posx,
-                            _area.height                    >> scale.posy);
-  isCodedBlk.fill( _isCoded );
+  fillTiled( m_isDecomp[chType], blk, m_mapLog2TileWidth[chType], m_mapLog2TileHeight[chType], m_mapNumTilesX[chType],
+             [&]( bool *ptr, const int stride, const int width, const int height, const unsigned )
+  {
+    AreaBuf<bool>( ptr, stride, width, height ).fill( _isCoded );
+  } );
 }
 
 void CodingStructure::setDecomp(const UnitArea &_area, const bool _isCoded /*= true*/)
@@ -183,6 +240,47 @@ void CodingStructure::setDecomp(const UnitArea &_area, const bool _isCoded /*= t
 }
 
 
+size_t CodingStructure::xMapAddr( const Position &pos, const ChannelType chType ) const
+{
+  const Position  &origin = area.blocks[chType].pos();
+  const UnitScale &scale  = unitScale[chType];
+  const unsigned   x      = ( pos.x - origin.x ) >> scale.posx;
+  const unsigned   y      = ( pos.y - origin.y ) >> scale.posy;
+  const unsigned   log2W  = m_mapLog2TileWidth [chType];
+  const unsigned   log2H  = m_mapLog2TileHeight[chType];
+  const unsigned   tile   = ( y >> log2H ) * m_mapNumTilesX[chType] + ( x >> log2W );
+
+  return ( size_t( tile ) << ( log2W + log2H ) ) + ( ( y & ( ( 1 << log2H ) - 1 ) ) << log2W ) + ( x & ( ( 1 << log2W ) - 1 ) );
+}
+
+unsigned CodingStructure::xGetUnitIdx( const uint16_t *map, const unsigned *base, const Position &pos, const ChannelType chType ) const
+{
+  const size_t   addr  = xMapAddr( pos, chType );
+  const unsigned local = map[addr];
+
+  return local ? base[addr >> ( m_mapLog2TileWidth[chType] + m_mapLog2TileHeight[chType] )] + local - 1 : 0;
+}
+
+void CodingStructure::xSetUnitIdx( uint16_t *map, unsigned *base, const CompArea &_blk, const unsigned idx )
+{
+  const UnitScale&  scale  = unitScale[_blk.compID];
+  const ChannelType chType = toChannelType( _blk.compID );
+  const Position    origin = area.blocks[_blk.compID].pos();
+  const Area        blk( ( _blk.x - origin.x ) >> scale.posx, ( _blk.y - origin.y ) >> scale.posy, _blk.width >> scale.posx, _blk.height >> scale.posy );
+
+  fillTiled( map, blk, m_mapLog2TileWidth[chType], m_mapLog2TileHeight[chType], m_mapNumTilesX[chType],
+             [&]( uint16_t *ptr, const int stride, const int width, const int height, const unsigned tileIdx )
+  {
+    if( base[tileIdx] == 0 )
+    {
+      base[tileIdx] = idx;
+    }
+    CHECK( idx - base[tileIdx] + 1 > std::numeric_limits<uint16_t>::max(), "Unit index exceeds the range of the tile" );
+    CHECK( *ptr, "Overwriting a pre-existing value, should be '0'!" );
+
+    AreaBuf<uint16_t>( ptr, stride, width, height ).fill( uint16_t( idx - base[tileIdx] + 1 ) );
+  } );
+}
 
 CodingUnit* CodingStructure::getCU( const Position &pos, const ChannelType effChType )
 {
@@ -195,7 +293,7 @@ CodingUnit* CodingStructure::getCU( const Position &pos, const ChannelType effCh
   }
   else
   {
-    const unsigned idx = m_cuIdx[effChType][rsAddr( pos, _blk.pos(), _blk.width, unitScale[effChType] )];
+    const unsigned idx = xGetUnitIdx( m_cuIdx[effChType], m_cuIdxBase[effChType], pos, effChType );
 
     if( idx != 0 ) return cus[ idx - 1 ];
     else           return nullptr;
@@ -213,7 +311,7 @@ const CodingUnit* CodingStructure::getCU( const Position &pos, const ChannelType
   }
   else
   {
-    const unsigned idx = m_cuIdx[effChType][rsAddr( pos, _blk.pos(), _blk.width, unitScale[effChType] )];
+    const unsigned idx = xGetUnitIdx( m_cuIdx[effChType], m_cuIdxBase[effChType], pos, effChType );
 
     if( idx != 0 ) return cus[ idx - 1 ];
     else           return nullptr;
@@ -231,7 +329,7 @@ PredictionUnit* CodingStructure::getPU( const Position &pos, const ChannelType e
   }
   else
   {
-    const unsigned idx = m_puIdx[effChType][rsAddr( pos, _blk.pos(), _blk.width, unitScale[effChType] )];
+    const unsigned idx = xGetUnitIdx( m_puIdx[effChType], m_puIdxBase[effChType], pos, effChType );
 
     if( idx != 0 ) return pus[ idx - 1 ];
     else           return nullptr;
@@ -249,7 +347,7 @@ const PredictionUnit * CodingStructure::getPU( const Position &pos, const Channe
   }
   else
   {
-    const unsigned idx = m_puIdx[effChType][rsAddr( pos, _blk.pos(), _blk.width, unitScale[effChType] )];
+    const unsigned idx = xGetUnitIdx( m_puIdx[effChType], m_puIdxBase[effChType], pos, effChType );
 
     if( idx != 0 ) return pus[ idx - 1 ];
     else           return nullptr;
@@ -267,7 +365,7 @@ TransformUnit* CodingStructure::getTU( const Position &pos, const ChannelType ef
   }
   else
   {
-    const unsigned idx = m_tuIdx[effChType][rsAddr( pos, _blk.pos(), _blk.width, unitScale[effChType] )];
+    const unsigned idx = xGetUnitIdx( m_tuIdx[effChType], m_tuIdxBase[effChType], pos, effChType );
 
     if( idx != 0 )       return tus[ idx - 1 ];
     else if( m_isTuEnc ) return parent->getTU( pos, effChType );
@@ -286,7 +384,7 @@ const TransformUnit * CodingStructure::getTU( const Position &pos, const Channel
   }
   else
   {
-    const unsigned idx = m_tuIdx[effChType][rsAddr( pos, _blk.pos(), _blk.width, unitScale[effChType] )];
+    const unsigned idx = xGetUnitIdx( m_tuIdx[effChType], m_tuIdxBase[effChType], pos, effChType );
 
     if( idx != 0 )       return tus[idx - 1];
     else if( m_isTuEnc ) return parent->getTU( pos, effChType );
@@ -334,15 +432,7 @@ CodingUnit& CodingStructure::addCU( const UnitArea &unit, const ChannelType chTy
       continue;
     }
 
-    const CompArea &_selfBlk = area.blocks[i];
-    const CompArea     &_blk = cu-> blocks[i];
-
-    const UnitScale& scale = unitScale[_blk.compID];
-    const Area scaledSelf  = scale.scale( _selfBlk );
-    const Area scaledBlk   = scale.scale(     _blk );
-    unsigned *idxPtr       = m_cuIdx[i] + rsAddr( scaledBlk.pos(), scaledSelf.pos(), scaledSelf.width );
-    CHECK( *idxPtr, "Overwriting a pre-existing value, should be '0'!" );
-    AreaBuf<uint32_t>( idxPtr, scaledSelf.width, scaledBlk.size() ).fill( idx );
+    xSetUnitIdx( m_cuIdx[i], m_cuIdxBase[i], cu->blocks[i], idx );
   }
 
   return *cu;
@@ -397,15 +487,7 @@ PredictionUnit& CodingStructure::addPU( const UnitArea &unit, const ChannelType
       continue;
     }
 
-    const CompArea &_selfBlk = area.blocks[i];
-    const CompArea     &_blk = pu-> blocks[i];
-
-    const UnitScale& scale = unitScale[_blk.compID];
-    const Area scaledSelf  = scale.scale( _selfBlk );
-    const Area scaledBlk   = scale.scale(     _blk );
-    unsigned *idxPtr       = m_puIdx[i] + rsAddr( scaledBlk.pos(), scaledSelf.pos(), scaledSelf.width );
-    CHECK( *idxPtr, "Overwriting a pre-existing value, should be '0'!" );
-    AreaBuf<uint32_t>( idxPtr, scaledSelf.width, scaledBlk.size() ).fill( idx );
+    xSetUnitIdx( m_puIdx[i], m_puIdxBase[i], pu->blocks[i], idx );
   }
 
   return *pu;
@@ -453,8 +535,8 @@ TransformUnit& CodingStructure::addTU( const UnitArea &unit, const ChannelType c
   uint32_t idx = ++m_numTUs;
   tu->idx  = idx;
 
-  TCoeff *coeffs[5] = { nullptr, nullptr, nullptr, nullptr, nullptr };
-  Pel    *pcmbuf[5] = { nullptr, nullptr, nullptr, nullptr, nullptr };
+  TCoeffLevel *coeffs[5] = { nullptr, nullptr, nullptr, nullptr, nullptr };
+  Pel         *pcmbuf[5] = { nullptr, nullptr, nullptr, nullptr, nullptr };
 
   uint32_t numCh = ::getNumberValidComponents( area.chromaFormat );
 
@@ -467,18 +549,7 @@ TransformUnit& CodingStructure::addTU( const UnitArea &unit, const ChannelType c
 
     if (i < ::getNumberValidChannels(area.chromaFormat))
     {
-      const CompArea &_selfBlk = area.blocks[i];
-      const CompArea     &_blk = tu-> blocks[i];
-
-      {
-        const UnitScale& scale = unitScale[_blk.compID];
-
-        const Area scaledSelf  = scale.scale( _selfBlk );
-        const Area scaledBlk   = scale.scale(     _blk );
-        unsigned *idxPtr       = m_tuIdx[i] + rsAddr( scaledBlk.pos(), scaledSelf.pos(), scaledSelf.width );
-        CHECK( *idxPtr, "Overwriting a pre-existing value, should be '0'!" );
-        AreaBuf<uint32_t>( idxPtr, scaledSelf.width, scaledBlk.size() ).fill( idx );
-      }
+      xSetUnitIdx( m_tuIdx[i], m_tuIdxBase[i], tu->blocks[i], idx );
     }
 
     coeffs[i] = m_coeffs[i] + m_offsets[i];
@@ -602,16 +673,41 @@ void CodingStructure::createInternals( const UnitArea& _unit, const bool isTopLa
 
   unsigned numCh = ::getNumberValidChannels(area.chromaFormat);
 
+  // the top layer is tiled by CTUs, any other structure lies within a CTU and is a single tile
+  const unsigned  ctuSize = isTopLayer ? sps->getMaxCUWidth() : MAX_CU_SIZE;
+  const UnitArea  ctuArea( area.chromaFormat, Area( 0, 0, ctuSize, ctuSize ) );
+
   for (unsigned i = 0; i < numCh; i++)
   {
-    unsigned _area = unitScale[i].scale( area.blocks[i].size() ).area();
+    const Size size     = unitScale[i].scale( area.blocks[i].size() );
+    const Size tileSize = unitScale[i].scale( ctuArea.blocks[i].size() );
+
+    m_mapLog2TileWidth [i] = 0;
+    m_mapLog2TileHeight[i] = 0;
+    while( ( 1u << m_mapLog2TileWidth [i] ) < std::min( size.width,  tileSize.width  ) ) m_mapLog2TileWidth [i]++;
+    while( ( 1u << m_mapLog2TileHeight[i] ) < std::min( size.height, tileSize.height ) ) m_mapLog2TileHeight[i]++;
+
+    m_mapNumTilesX[i] = ( size.width  + ( 1 << m_mapLog2TileWidth [i] ) - 1 ) >> m_mapLog2TileWidth [i];
+    m_mapNumTiles [i] = ( size.height + ( 1 << m_mapLog2TileHeight[i] ) - 1 ) >> m_mapLog2TileHeight[i];
+    m_mapNumTiles [i] *= m_mapNumTilesX[i];
+    m_mapSize     [i] = size.area() > 0 ? size_t( m_mapNumTiles[i] ) << ( m_mapLog2TileWidth[i] + m_mapLog2TileHeight[i] ) : 0;
+
+    const size_t _area = m_mapSize[i];
+
+    m_cuIdx[i]    = _area > 0 ? new uint16_t[_area]() : nullptr;
+    m_puIdx[i]    = _area > 0 ? new uint16_t[_area]() : nullptr;
+    m_tuIdx[i]    = _area > 0 ? new uint16_t[_area]() : nullptr;
+    m_isDecomp[i] = _area > 0 ? new bool    [_area]() : nullptr;
 
-    m_cuIdx[i]    = _area > 0 ? new unsigned[_area] : nullptr;
-    m_puIdx[i]    = _area > 0 ? new unsigned[_area] : nullptr;
-    m_tuIdx[i]    = _area > 0 ? new unsigned[_area] : nullptr;
-    m_isDecomp[i] = _area > 0 ? new bool    [_area] : nullptr;
+    m_cuIdxBase[i] = _area > 0 ? new unsigned[m_mapNumTiles[i]]() : nullptr;
+    m_puIdxBase[i] = _area > 0 ? new unsigned[m_mapNumTiles[i]]() : nullptr;
+    m_tuIdxBase[i] = _area > 0 ? new unsigned[m_mapNumTiles[i]]() : nullptr;
   }
 
+  m_numCUs = 0;
+  m_numPUs = 0;
+  m_numTUs = 0;
+
   numCh = getNumberValidComponents(area.chromaFormat);
 
   for (unsigned i = 0; i < numCh; i++)
@@ -619,6 +715,9 @@ void CodingStructure::createInternals( const UnitArea& _unit, const bool isTopLa
     m_offsets[i] = 0;
   }
 
+  // the coefficients of the top layer are only needed while coding a picture and are kept in the picture buffer pool
+  m_poolCoeffs = isTopLayer;
+
   if( !isTopLayer ) createCoeffs();
 
   unsigned _lumaAreaScaled = g_miScaling.scale( area.lumaSize() ).area();
@@ -651,8 +750,16 @@ void CodingStructure::createCoeffs()
   {
     unsigned _area = area.blocks[i].area();
 
-    m_coeffs[i] = _area > 0 ? ( TCoeff* ) xMalloc( TCoeff, _area ) : nullptr;
-    m_pcmbuf[i] = _area > 0 ? ( Pel*    ) xMalloc( Pel,    _area ) : nullptr;
+    if( m_poolCoeffs )
+    {
+      m_coeffs[i] = _area > 0 ? ( TCoeffLevel* ) g_picBufferPool.get( sizeof( TCoeffLevel ) * _area, PIC_BUF_ROLE_COEFFS ) : nullptr;
+      m_pcmbuf[i] = _area > 0 ? ( Pel*         ) g_picBufferPool.get( sizeof( Pel         ) * _area, PIC_BUF_ROLE_COEFFS ) : nullptr;
+    }
+    else
+    {
+      m_coeffs[i] = _area > 0 ? ( TCoeffLevel* ) xMalloc( TCoeffLevel, _area ) : nullptr;
+      m_pcmbuf[i] = _area > 0 ? ( Pel*         ) xMalloc( Pel,         _area ) : nullptr;
+    }
   }
 }
 
@@ -660,6 +767,11 @@ void CodingStructure::destroyCoeffs()
 {
   for( uint32_t i = 0; i < MAX_NUM_COMPONENT; i++ )
   {
+    if( m_poolCoeffs )
+    {
+      g_picBufferPool.give( m_coeffs[i] ); m_coeffs[i] = nullptr;
+      g_picBufferPool.give( m_pcmbuf[i] ); m_pcmbuf[i] = nullptr;
+    }
     if( m_coeffs[i] ) { xFree( m_coeffs[i] ); m_coeffs[i] = nullptr; }
     if( m_pcmbuf[i] ) { xFree( m_pcmbuf[i] ); m_pcmbuf[i] = nullptr; }
   }
@@ -721,7 +833,7 @@ void CodingStructure::initSubStructure( CodingStructure& subStruct, const Channe
     unsigned numComp = ::getNumberValidChannels( area.chromaFormat );
     for( unsigned i = 0; i < numComp; i++)
     {
-      ::memcpy( subStruct.m_isDecomp[i], m_isDecomp[i], (unitScale[i].scale( area.blocks[i].size() ).area() * sizeof( bool ) ) );
+      ::memcpy( subStruct.m_isDecomp[i], m_isDecomp[i], m_mapSize[i] * sizeof( bool ) );
     }
   }
 }
@@ -887,6 +999,130 @@ void CodingStructure::useSubStructure( const CodingStructure& subStruct, const C
   }
 }
 
+void CodingStructure::adoptSubStructure( CodingStructure& subStruct, const ChannelType chType, const UnitArea &subArea, const bool cpyPred, const bool cpyOrgResi, const bool cpyResi )
+{
+  CHECK( !parent, "Sub-structures can only be adopted by temporary structures" );
+  CHECK( subStruct.m_isTuEnc, "Sub-structures created for the TU encoding cannot be adopted" );
+  CHECKD( !area.contains( subArea ), "Trying to use a sub-structure not contained in self" );
+
+  UnitArea clippedArea = clipArea( subArea, *picture );
+
+  setDecomp( clippedArea );
+
+  if( cpyPred )    getPredBuf   ( clippedArea ).copyFrom( subStruct.getPredBuf   ( clippedArea ) );
+  if( cpyResi )    getResiBuf   ( clippedArea ).copyFrom( subStruct.getResiBuf   ( clippedArea ) );
+  if( cpyOrgResi ) getOrgResiBuf( clippedArea ).copyFrom( subStruct.getOrgResiBuf( clippedArea ) );
+
+  getRecoBuf( clippedArea ).copyFrom( subStruct.getRecoBuf( clippedArea ) );
+
+  if( cpyPred ) picture->getPredBuf( clippedArea ).copyFrom( subStruct.getPredBuf( clippedArea ) );
+  if( cpyResi ) picture->getResiBuf( clippedArea ).copyFrom( subStruct.getResiBuf( clippedArea ) );
+
+  if( !slice->isIntra() )
+  {
+    // copy motion buffer
+    MotionBuf ownMB  = getMotionBuf          ( clippedArea );
+    CMotionBuf subMB = subStruct.getMotionBuf( clippedArea );
+
+    ownMB.copyFrom( subMB );
+  }
+
+  fracBits += subStruct.fracBits;
+  dist     += subStruct.dist;
+  cost     += subStruct.cost;
+
+  const uint32_t numCh = ::getNumberValidChannels( area.chromaFormat );
+
+  // re-parent the CUs, the links between the units of the sub-structure stay valid
+  for( auto &cu : subStruct.cus )
+  {
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
+    CHECK( m_numCUs > 0 && cus.back()->cacheId != cu->cacheId, "Inconsintent cacheId between previous and current CU" );
+#endif
+    if( m_numCUs > 0 )
+    {
+      cus.back()->next = cu;
+    }
+
+    cus.push_back( cu );
+
+    cu->cs  = this;
+    cu->idx = ++m_numCUs;
+
+    for( uint32_t i = 0; i < numCh; i++ )
+    {
+      if( cu->blocks[i].valid() )
+      {
+        xSetUnitIdx( m_cuIdx[i], m_cuIdxBase[i], cu->blocks[i], cu->idx );
+      }
+    }
+  }
+
+  for( auto &pu : subStruct.pus )
+  {
+    pus.push_back( pu );
+
+    pu->cs  = this;
+    pu->idx = ++m_numPUs;
+
+    for( uint32_t i = 0; i < numCh; i++ )
+    {
+      if( pu->blocks[i].valid() )
+      {
+        xSetUnitIdx( m_puIdx[i], m_puIdxBase[i], pu->blocks[i], pu->idx );
+      }
+    }
+  }
+
+  // the coefficients are stored with the structure and still need to be copied
+  const uint32_t numComp = ::getNumberValidComponents( area.chromaFormat );
+
+  for( auto &tu : subStruct.tus )
+  {
+    tus.push_back( tu );
+
+    tu->cs  = this;
+    tu->idx = ++m_numTUs;
+
+    TCoeffLevel *coeffs[5] = { nullptr, nullptr, nullptr, nullptr, nullptr };
+    Pel         *pcmbuf[5] = { nullptr, nullptr, nullptr, nullptr, nullptr };
+
+    for( uint32_t i = 0; i < numComp; i++ )
+    {
+      if( !tu->blocks[i].valid() )
+      {
+        continue;
+      }
+
+      if( i < numCh )
+      {
+        xSetUnitIdx( m_tuIdx[i], m_tuIdxBase[i], tu->blocks[i], tu->idx );
+      }
+
+      const unsigned areaSize = tu->blocks[i].area();
+
+      coeffs[i] = m_coeffs[i] + m_offsets[i];
+      pcmbuf[i] = m_pcmbuf[i] + m_offsets[i];
+
+      ::memcpy( coeffs[i], tu->getCoeffs( ComponentID( i ) ).buf, sizeof( TCoeffLevel ) * areaSize );
+      ::memcpy( pcmbuf[i], tu->getPcmbuf( ComponentID( i ) ).buf, sizeof( Pel         ) * areaSize );
+
+      m_offsets[i] += areaSize;
+    }
+
+    tu->init( coeffs, pcmbuf );
+  }
+
+  // the units are owned by this structure now, clear the sub-structure without handing them back to the cache
+  subStruct.tus.clear();
+  subStruct.pus.clear();
+  subStruct.cus.clear();
+
+  subStruct.clearTUs();
+  subStruct.clearPUs();
+  subStruct.clearCUs();
+}
+
 void CodingStructure::copyStructure( const CodingStructure& other, const ChannelType chType, const bool copyTUs, const bool copyRecoBuf )
 {
   fracBits = other.fracBits;
@@ -984,6 +1220,12 @@ void CodingStructure::initStructData( const int &QP, const bool &_isLosses, cons
     isLossless            = _isLosses;
   }
 
+  if( m_motionBuf == nullptr )
+  {
+    // the full motion field was released when the motion of the previous picture got compressed
+    m_motionBuf = new MotionInfo[g_miScaling.scale( area.lumaSize() ).area()];
+  }
+
   if( !skipMotBuf && ( !parent || ( ( slice->getSliceType() != I_SLICE ) && !m_isTuEnc ) ) )
   {
     getMotionBuf()      .memset( 0 );
@@ -1001,10 +1243,14 @@ void CodingStructure::clearTUs()
   int numCh = ::getNumberValidChannels( area.chromaFormat );
   for( int i = 0; i < numCh; i++ )
   {
-    size_t _area = ( area.blocks[i].area() >> unitScale[i].area );
+    memset( m_isDecomp[i], false, sizeof( *m_isDecomp[0] ) * m_mapSize[i] );
 
-    memset( m_isDecomp[i], false, sizeof( *m_isDecomp[0] ) * _area );
-    memset( m_tuIdx   [i],     0, sizeof( *m_tuIdx   [0] ) * _area );
+    // an empty map is still clear
+    if( m_numTUs > 0 )
+    {
+      memset( m_tuIdx    [i], 0, sizeof( *m_tuIdx    [0] ) * m_mapSize[i] );
+      memset( m_tuIdxBase[i], 0, sizeof( *m_tuIdxBase[0] ) * m_mapNumTiles[i] );
+    }
   }
 
   numCh = getNumberValidComponents( area.chromaFormat ); 
@@ -1027,7 +1273,11 @@ void CodingStructure::clearPUs()
   int numCh = ::getNumberValidChannels( area.chromaFormat );
   for( int i = 0; i < numCh; i++ )
   {
-    memset( m_puIdx[i], 0, sizeof( *m_puIdx[0] ) * unitScale[i].scaleArea( area.blocks[i].area() ) );
+    if( m_numPUs > 0 )
+    {
+      memset( m_puIdx    [i], 0, sizeof( *m_puIdx    [0] ) * m_mapSize[i] );
+      memset( m_puIdxBase[i], 0, sizeof( *m_puIdxBase[0] ) * m_mapNumTiles[i] );
+    }
   }
 
   m_puCache.cache( pus );
@@ -1044,7 +1294,11 @@ void CodingStructure::clearCUs()
   int numCh = ::getNumberValidChannels( area.chromaFormat );
   for( int i = 0; i < numCh; i++ )
   {
-    memset( m_cuIdx[i], 0, sizeof( *m_cuIdx[0] ) * unitScale[i].scaleArea( area.blocks[i].area() ) );
+    if( m_numCUs > 0 )
+    {
+      memset( m_cuIdx    [i], 0, sizeof( *m_cuIdx    [0] ) * m_mapSize[i] );
+      memset( m_cuIdxBase[i], 0, sizeof( *m_cuIdxBase[0] ) * m_mapNumTiles[i] );
+    }
   }
 
   m_cuCache.cache( cus );
@@ -1100,6 +1354,60 @@ const MotionInfo& CodingStructure::getMotionInfo( const Position& pos ) const
 }
 
 
+void CodingStructure::compressMotion()
+{
+  CHECK( parent, "Only the motion field of a picture can be compressed" );
+
+  // the temporal motion vector prediction reads the motion at the top-left of each 8x8 block
+  // (or of each 4x4 block when the motion compression is disabled)
+  const int scale = pcv->noMotComp ? ( 1 << MIN_CU_LOG2 ) : 4 * std::max<int>( 1, 4 * AMVP_DECIMATION_FACTOR / 4 );
+
+  m_colMotionLog2Scale = g_aucLog2[scale];
+  m_colMotionStride    = ( area.lwidth() + scale - 1 ) >> m_colMotionLog2Scale;
+
+  const size_t size = m_colMotionStride * ( ( area.lheight() + scale - 1 ) >> m_colMotionLog2Scale );
+
+  if( m_colMotionSize < size )
+  {
+    delete[] m_colMotionBuf;
+    m_colMotionBuf  = new PackedMotionInfo[size];
+    m_colMotionSize = size;
+  }
+
+  const CMotionBuf mb   = getMotionBuf();
+  const int        step = scale >> MIN_CU_LOG2;
+
+  for( int y = 0, yc = 0; y < mb.height; y += step, yc++ )
+  {
+    PackedMotionInfo* dst = m_colMotionBuf + yc * m_colMotionStride;
+
+    for( int x = 0, xc = 0; x < mb.width; x += step, xc++ )
+    {
+      dst[xc] = PackedMotionInfo( mb.at( x, y ) );
+    }
+  }
+
+  // the full motion field is re-created with the next picture coded into this structure
+  delete[] m_motionBuf;
+  m_motionBuf = nullptr;
+}
+
+PackedMotionInfo CodingStructure::getColMotionInfo( const Position& pos ) const
+{
+  if( m_motionBuf )
+  {
+    // the motion of this picture has not been compressed yet
+    return PackedMotionInfo( getMotionInfo( pos ) );
+  }
+
+  CHECKD( !area.Y().contains( pos ), "Trying to access motion information outside of this coding structure" );
+
+  const Position colPos = pos - area.lumaPos();
+
+  return m_colMotionBuf[( colPos.y >> m_colMotionLog2Scale ) * m_colMotionStride + ( colPos.x >> m_colMotionLog2Scale )];
+}
+
+
 // data accessors
        PelBuf     CodingStructure::getPredBuf(const CompArea &blk)           { return getBuf(blk,  PIC_PREDICTION); }
 const CPelBuf     CodingStructure::getPredBuf(const CompArea &blk)     const { return getBuf(blk,  PIC_PREDICTION); }
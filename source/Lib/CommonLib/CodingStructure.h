@@ -58,6 +58,10 @@ enum PictureType
   PIC_ORG_RESI,
   NUM_PIC_TYPES
 };
+
+// the buffers taken from g_picBufferPool are accounted by their PictureType, or as coefficients
+static const int PIC_BUF_ROLE_COEFFS = NUM_PIC_TYPES;
+static const int NUM_PIC_BUF_ROLES   = NUM_PIC_TYPES + 1;
 extern XUCache g_globalUnitCache;
 
 // ---------------------------------------------------------------------------
@@ -163,6 +167,9 @@ public:
   void copyStructure   (const CodingStructure& cs, const ChannelType chType, const bool copyTUs = false, const bool copyRecoBuffer = false);
   void useSubStructure (const CodingStructure& cs, const ChannelType chType, const UnitArea &subArea, const bool cpyPred, const bool cpyReco, const bool cpyOrgResi, const bool cpyResi);
   void useSubStructure (const CodingStructure& cs, const ChannelType chType,                          const bool cpyPred, const bool cpyReco, const bool cpyOrgResi, const bool cpyResi) { useSubStructure(cs, chType, cs.area, cpyPred, cpyReco, cpyOrgResi, cpyResi); }
+  // like useSubStructure, but the units are moved from the sub-structure instead of copied, leaving it empty,
+  // and the reconstruction is only copied to this structure as the picture is expected to hold it already
+  void adoptSubStructure(      CodingStructure& cs, const ChannelType chType, const UnitArea &subArea, const bool cpyPred, const bool cpyOrgResi, const bool cpyResi);
 
   void clearTUs();
   void clearPUs();
@@ -183,15 +190,31 @@ private:
   // needed for TU encoding
   bool m_isTuEnc;
 
-  unsigned *m_cuIdx   [MAX_NUM_CHANNEL_TYPE];
-  unsigned *m_puIdx   [MAX_NUM_CHANNEL_TYPE];
-  unsigned *m_tuIdx   [MAX_NUM_CHANNEL_TYPE];
+  // the unit index maps are stored in CTU sized tiles, so that the units of a CTU are kept in contiguous memory,
+  // and hold 16 bit indices relative to the first unit added to the tile (0 for none)
+  uint16_t *m_cuIdx   [MAX_NUM_CHANNEL_TYPE];
+  uint16_t *m_puIdx   [MAX_NUM_CHANNEL_TYPE];
+  uint16_t *m_tuIdx   [MAX_NUM_CHANNEL_TYPE];
   bool     *m_isDecomp[MAX_NUM_CHANNEL_TYPE];
 
+  unsigned *m_cuIdxBase[MAX_NUM_CHANNEL_TYPE];
+  unsigned *m_puIdxBase[MAX_NUM_CHANNEL_TYPE];
+  unsigned *m_tuIdxBase[MAX_NUM_CHANNEL_TYPE];
+
+  unsigned m_mapLog2TileWidth [MAX_NUM_CHANNEL_TYPE];
+  unsigned m_mapLog2TileHeight[MAX_NUM_CHANNEL_TYPE];
+  unsigned m_mapNumTilesX     [MAX_NUM_CHANNEL_TYPE];
+  unsigned m_mapNumTiles      [MAX_NUM_CHANNEL_TYPE];
+  size_t   m_mapSize          [MAX_NUM_CHANNEL_TYPE];
+
   unsigned m_numCUs;
   unsigned m_numPUs;
   unsigned m_numTUs;
 
+  size_t   xMapAddr   ( const Position &pos, const ChannelType chType ) const;
+  unsigned xGetUnitIdx( const uint16_t *map, const unsigned *base, const Position &pos, const ChannelType chType ) const;
+  void     xSetUnitIdx(       uint16_t *map,       unsigned *base, const CompArea &blk, const unsigned idx );
+
   CUCache& m_cuCache;
   PUCache& m_puCache;
   TUCache& m_tuCache;
@@ -203,13 +226,19 @@ private:
   PelStorage m_reco;
   PelStorage m_orgr;
 
-  TCoeff *m_coeffs [ MAX_NUM_COMPONENT ];
-  Pel    *m_pcmbuf [ MAX_NUM_COMPONENT ];
+  TCoeffLevel *m_coeffs [ MAX_NUM_COMPONENT ];
+  Pel         *m_pcmbuf [ MAX_NUM_COMPONENT ];
 
   int     m_offsets[ MAX_NUM_COMPONENT ];
+  bool    m_poolCoeffs;
 
   MotionInfo *m_motionBuf;
 
+  PackedMotionInfo *m_colMotionBuf;
+  size_t            m_colMotionSize;
+  unsigned          m_colMotionStride;
+  unsigned          m_colMotionLog2Scale;
+
 public:
 
   MotionBuf getMotionBuf( const     Area& _area );
@@ -223,6 +252,10 @@ public:
   MotionInfo& getMotionInfo( const Position& pos );
   const MotionInfo& getMotionInfo( const Position& pos ) const;
 
+  // once a picture is coded, only the sub-sampled motion read by the temporal motion vector prediction is kept
+  void             compressMotion  ();
+  PackedMotionInfo getColMotionInfo( const Position& pos ) const;
+
 
 public:
   // ---------------------------------------------------------------------------
@@ -284,6 +284,8 @@ static const int SCALING_LIST_DC =                                 16; ///< defa
 static const int CONTEXT_STATE_BITS =                               6;
 static const int LAST_SIGNIFICANT_GROUPS =                         14;
 static const int MAX_GR_ORDER_RESIDUAL =                           10;
+static const int RDOQ_NUM_CTX_OFFSETS =                            21; ///< number of context offsets for the parity/greater1/greater2 flags (see CoeffCodingContext::ctxOffsetAbs)
+static const int RDOQ_NUM_LEVEL_RATES =                             7; ///< cached RDOQ level rates per context offset: levels 1 to 4 and the two parities of escape-coded levels
 
 static const int AFFINE_MAX_NUM_V0 =                                3; ///< max number of motion candidates in top-left corner
 static const int AFFINE_MAX_NUM_V1 =                                2; ///< max number of motion candidates in top-right corner
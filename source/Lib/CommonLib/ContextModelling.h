@@ -99,11 +99,11 @@ public:
   unsigned        lastYCtxId      ( unsigned  posLastY  )   const { return m_CtxSetLastY( m_lastOffsetY + ( posLastY >> m_lastShiftY ) ); }
   unsigned        sigGroupCtxId   ()                        const { return m_sigGroupCtxId; }
 
-  unsigned sigCtxIdAbs( int scanPos, const TCoeff* coeff, const int state )
+  unsigned sigCtxIdAbs( int scanPos, const TCoeffLevel* coeff, const int state )
   {
     const uint32_t    posY      = m_scanPosY[ scanPos ];
     const uint32_t    posX      = m_scanPosX[ scanPos ];
-    const TCoeff* pData     = coeff + posX + posY * m_width;
+    const TCoeffLevel* pData = coeff + posX + posY * m_width;
     const int     diag      = posX + posY;
     int           numPos    = 0;
     int           sumAbs    = 0;
@@ -154,12 +154,12 @@ public:
   unsigned greater1CtxIdAbs ( uint8_t offset )  const { return m_gtxFlagCtxSet[1]( offset ); }
   unsigned greater2CtxIdAbs ( uint8_t offset )  const { return m_gtxFlagCtxSet[0]( offset ); }
 
-  unsigned GoRiceParAbs( int scanPos, const TCoeff* coeff ) const
+  unsigned GoRiceParAbs( int scanPos, const TCoeffLevel* coeff ) const
   {
 #define UPDATE(x) sum+=abs(x)-!!x
     const uint32_t    posY      = m_scanPosY[ scanPos ];
     const uint32_t    posX      = m_scanPosX[ scanPos ];
-    const TCoeff* pData     = coeff + posX + posY * m_width;
+    const TCoeffLevel* pData = coeff + posX + posY * m_width;
     int           sum       = 0;
     if( posX < m_width-1 )
     {
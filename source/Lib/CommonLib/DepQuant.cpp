@@ -713,7 +713,7 @@ namespace DQIntern
     const CoeffScanType scanType  = SCAN_DIAG;
 #endif
     const unsigned*     scan      = g_scanOrder[ SCAN_GROUPED_4x4 ][ scanType ][ hsId ][ vsId ];
-    const TCoeff*       qCoeff    = tu.getCoeffs( compID ).buf;
+    const TCoeffLevel*  qCoeff    = tu.getCoeffs( compID ).buf;
           TCoeff*       tCoeff    = recCoeff.buf;
 
     //----- reset coefficients and get last scan index -----
@@ -763,7 +763,7 @@ namespace DQIntern
     for( int state = 0, scanIdx = lastScanIdx; scanIdx >= 0; scanIdx-- )
     {
       const unsigned  rasterPos = scan  [ scanIdx   ];
-      const TCoeff&   level     = qCoeff[ rasterPos ];
+      const TCoeff    level     = qCoeff[ rasterPos ];
       if( level )
       {
         Intermediate_Int  qIdx      = ( level << 1 ) + ( level > 0 ? -(state>>1) : (state>>1) );
@@ -1316,10 +1316,10 @@ namespace DQIntern
     //===== reset / pre-init =====
     RateEstimator::initBlock  ( tu, compID );
     m_quant.initQuantBlock    ( tu, compID, cQP, lambda );
-    TCoeff*       qCoeff      = tu.getCoeffs( compID ).buf;
+    TCoeffLevel*  qCoeff      = tu.getCoeffs( compID ).buf;
     const TCoeff* tCoeff      = srcCoeff.buf;
     const int     numCoeff    = tu.blocks[compID].area();
-    ::memset( tu.getCoeffs( compID ).buf, 0x00, numCoeff*sizeof(TCoeff) );
+    ::memset( tu.getCoeffs( compID ).buf, 0x00, numCoeff*sizeof(TCoeffLevel) );
     absSum          = 0;
 
     //===== find first test position =====
@@ -1372,7 +1372,7 @@ namespace DQIntern
     {
       decision          = m_trellis[ scanIdx ][ decision.prevId ];
       int32_t blkpos    = rasterPos( scanIdx );
-      qCoeff[ blkpos ]  = ( tCoeff[ blkpos ] < 0 ? -decision.absLevel : decision.absLevel );
+      qCoeff[ blkpos ]  = TCoeffLevel( tCoeff[ blkpos ] < 0 ? -decision.absLevel : decision.absLevel );
       absSum           += decision.absLevel;
     }
   }
@@ -46,6 +46,13 @@
 //! \ingroup CommonLib
 //! \{
 
+// samples before and after a reference block read by the interpolation filters
+static const int REF_FILTER_MARGIN_BEFORE = ( NTAPS_LUMA >> 1 ) - 1;
+static const int REF_FILTER_MARGIN_AFTER  = NTAPS_LUMA >> 1;
+// the clamped fetch buffer also covers the samples over-read by the SIMD filter kernels on the right
+static const int CLAMPED_REF_MARGIN_RIGHT = REF_FILTER_MARGIN_AFTER + 12;
+static const int CLAMPED_REF_STRIDE       = REF_FILTER_MARGIN_BEFORE + MAX_CU_SIZE + CLAMPED_REF_MARGIN_RIGHT;
+
 // ====================================================================================================================
 // Constructor / destructor / initialize
 // ====================================================================================================================
@@ -77,6 +84,7 @@ InterPrediction::InterPrediction()
     }
   }
 
+  m_clampedRefBlock = nullptr;
 }
 
 InterPrediction::~InterPrediction()
@@ -109,6 +117,9 @@ void InterPrediction::destroy()
       m_filteredBlockTmp[i][c] = nullptr;
     }
   }
+
+  xFree( m_clampedRefBlock );
+  m_clampedRefBlock = nullptr;
 }
 
 void InterPrediction::init( RdCost* pcRdCost, ChromaFormat chromaFormatIDC )
@@ -146,6 +157,8 @@ void InterPrediction::init( RdCost* pcRdCost, ChromaFormat chromaFormatIDC )
       }
     }
 
+    m_clampedRefBlock = ( Pel* ) xMalloc( Pel, CLAMPED_REF_STRIDE * ( REF_FILTER_MARGIN_BEFORE + MAX_CU_SIZE + REF_FILTER_MARGIN_AFTER ) );
+
 
     m_iRefListIdx = -1;
     
@@ -347,6 +360,29 @@ void InterPrediction::xPredInterBi(PredictionUnit& pu, PelUnitBuf &pcYuvPred)
   const PPS   &pps   = *pu.cs->pps;
   const Slice &slice = *pu.cs->slice;
 
+  const bool bWP = ( pps.getUseWP() && slice.getSliceType() == P_SLICE ) || ( pps.getWPBiPred() && slice.getSliceType() == B_SLICE );
+
+  if( bWP && ( pu.refIdx[0] < 0 || pu.refIdx[1] < 0 ) )
+  {
+    // uni-directional weighted prediction: interpolate at high precision straight into the
+    // destination and apply the weighting in place, bypassing the per-list intermediate buffers
+    const RefPicList eRefPicList = pu.refIdx[0] >= 0 ? REF_PIC_LIST_0 : REF_PIC_LIST_1;
+
+    CHECK( pu.refIdx[eRefPicList] >= slice.getNumRefIdx( eRefPicList ), "Invalid reference index" );
+    m_iRefListIdx = eRefPicList;
+
+    xPredInterUni( pu, eRefPicList, pcYuvPred, true );
+
+    if( slice.getSliceType() == B_SLICE )
+    {
+      xWeightedPredictionBi( pu, pcYuvPred, pcYuvPred, pcYuvPred, m_maxCompIDToPred );
+    }
+    else
+    {
+      xWeightedPredictionUni( pu, pcYuvPred, REF_PIC_LIST_0, pcYuvPred, -1, m_maxCompIDToPred );
+    }
+    return;
+  }
 
   for (uint32_t refList = 0; refList < NUM_REF_PIC_LIST_01; refList++)
   {
@@ -443,7 +479,7 @@ void InterPrediction::xPredInterBlk ( const ComponentID& compID, const Predictio
   CPelBuf refBuf;
   {
     Position offset = pu.blocks[compID].pos().offset( _mv.getHor() >> shiftHor, _mv.getVer() >> shiftVer );
-    refBuf = refPic->getRecoBuf( CompArea( compID, chFmt, offset, pu.blocks[compID].size() ) );
+    refBuf = xGetRefBuf( refPic, CompArea( compID, chFmt, offset, pu.blocks[compID].size() ) );
   }
 
   if( yFrac == 0 )
@@ -466,6 +502,57 @@ void InterPrediction::xPredInterBlk ( const ComponentID& compID, const Predictio
   }
 }
 
+CPelBuf InterPrediction::xGetRefBuf( const Picture* refPic, const CompArea& blk )
+{
+  const CPelBuf picBuf = refPic->getRecoBuf( blk.compID );
+  const int     width  = picBuf.width;
+  const int     height = picBuf.height;
+
+  if( refPic->getBorderExtension()
+    || ( blk.x >= REF_FILTER_MARGIN_BEFORE && blk.x + ( int ) blk.width  + REF_FILTER_MARGIN_AFTER <= width
+      && blk.y >= REF_FILTER_MARGIN_BEFORE && blk.y + ( int ) blk.height + REF_FILTER_MARGIN_AFTER <= height ) )
+  {
+    return refPic->getRecoBuf( blk );
+  }
+
+  // the block and its filter support reach outside of a picture without padded border:
+  // gather the samples with clamped coordinates, which reproduces the padding exactly
+  CHECKD( blk.width > MAX_CU_SIZE || blk.height > MAX_CU_SIZE, "Reference block exceeds the clamped fetch buffer" );
+
+  const int x0 = blk.x - REF_FILTER_MARGIN_BEFORE;
+  const int x1 = blk.x + ( int ) blk.width + CLAMPED_REF_MARGIN_RIGHT;
+  const int y0 = blk.y - REF_FILTER_MARGIN_BEFORE;
+  const int y1 = blk.y + ( int ) blk.height + REF_FILTER_MARGIN_AFTER;
+
+  // the columns left and right of [xl, xr) are copies of the first and last picture column
+  const int xl = Clip3( x0, x1, 0 );
+  const int xr = Clip3( xl, x1, width );
+
+  Pel* dst = m_clampedRefBlock;
+
+  for( int y = y0; y < y1; y++, dst += CLAMPED_REF_STRIDE )
+  {
+    const Pel* src = picBuf.bufAt( 0, Clip3( 0, height - 1, y ) );
+
+    for( int x = x0; x < xl; x++ )
+    {
+      dst[x - x0] = src[0];
+    }
+
+    if( xr > xl )
+    {
+      ::memcpy( dst + xl - x0, src + xl, ( xr - xl ) * sizeof( Pel ) );
+    }
+
+    for( int x = xr; x < x1; x++ )
+    {
+      dst[x - x0] = src[width - 1];
+    }
+  }
+
+  return CPelBuf( m_clampedRefBlock + REF_FILTER_MARGIN_BEFORE * ( CLAMPED_REF_STRIDE + 1 ), CLAMPED_REF_STRIDE, blk.size() );
+}
+
 void InterPrediction::xPredAffineBlk( const ComponentID& compID, const PredictionUnit& pu, const Picture* refPic, const Mv* _mv, PelUnitBuf& dstPic, const bool& bi, const ClpRng& clpRng )
 {
   if ( (pu.cu->affineType == AFFINEMODEL_6PARAM && _mv[0] == _mv[1] && _mv[0] == _mv[2])
@@ -536,18 +623,44 @@ void InterPrediction::xPredAffineBlk( const ComponentID& compID, const Predictio
 
   const int shift = iBit - 4 + VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE + 2;
 
-  // get prediction block by block
+  const int numSubBlkX = cxWidth / blockWidth;
+  int subBlkMvHor[MAX_CU_SIZE / AFFINE_MIN_BLOCK_SIZE];
+  int subBlkMvVer[MAX_CU_SIZE / AFFINE_MIN_BLOCK_SIZE];
+
+  PelBuf &dstBuf = dstPic.bufs[compID];
+
+  // get prediction row of sub-blocks by row of sub-blocks
   for ( int h = 0; h < cxHeight; h += blockHeight )
   {
-    for ( int w = 0; w < cxWidth; w += blockWidth )
+    // derive the clipped motion vectors of all sub-blocks in the row in one pass
+    const int iMvRowHor = iMvScaleHor + iDMvHorX * iHalfBW + iDMvVerX * (iHalfBH + h);
+    const int iMvRowVer = iMvScaleVer + iDMvHorY * iHalfBW + iDMvVerY * (iHalfBH + h);
+
+    for ( int i = 0; i < numSubBlkX; i++ )
     {
-      int iMvScaleTmpHor = iMvScaleHor + iDMvHorX * (iHalfBW + w) + iDMvVerX * (iHalfBH + h);
-      int iMvScaleTmpVer = iMvScaleVer + iDMvHorY * (iHalfBW + w) + iDMvVerY * (iHalfBH + h);
+      int iMvScaleTmpHor = iMvRowHor + iDMvHorX * i * blockWidth;
+      int iMvScaleTmpVer = iMvRowVer + iDMvHorY * i * blockWidth;
       roundAffineMv( iMvScaleTmpHor, iMvScaleTmpVer, shift );
 
       // clip and scale
-      iMvScaleTmpHor = std::min<int>( iHorMax, std::max<int>( iHorMin, iMvScaleTmpHor ) );
-      iMvScaleTmpVer = std::min<int>( iVerMax, std::max<int>( iVerMin, iMvScaleTmpVer ) );
+      subBlkMvHor[i] = std::min<int>( iHorMax, std::max<int>( iHorMin, iMvScaleTmpHor ) );
+      subBlkMvVer[i] = std::min<int>( iVerMax, std::max<int>( iVerMin, iMvScaleTmpVer ) );
+    }
+
+    // neighbouring sub-blocks sharing the same motion vector are interpolated in a single call
+    for ( int i = 0; i < numSubBlkX; )
+    {
+      int iEnd = i + 1;
+      while ( iEnd < numSubBlkX && subBlkMvHor[iEnd] == subBlkMvHor[i] && subBlkMvVer[iEnd] == subBlkMvVer[i] )
+      {
+        iEnd++;
+      }
+
+      const int w        = i * blockWidth;
+      const int runWidth = ( iEnd - i ) * blockWidth;
+
+      const int iMvScaleTmpHor = subBlkMvHor[i];
+      const int iMvScaleTmpVer = subBlkMvVer[i];
 
       // get the MV in high precision
       int xFrac, yFrac, xInt, yInt;
@@ -573,24 +686,30 @@ void InterPrediction::xPredAffineBlk( const ComponentID& compID, const Predictio
         yFrac = iMvScaleTmpVer & 31;
       }
 
-      const CPelBuf refBuf = refPic->getRecoBuf( CompArea( compID, chFmt, pu.blocks[compID].offset(xInt + w, yInt + h), pu.blocks[compID] ) );
-      PelBuf &dstBuf = dstPic.bufs[compID];
+      const CPelBuf refBuf = xGetRefBuf( refPic, CompArea( compID, chFmt, pu.blocks[compID].offset(xInt + w, yInt + h), Size( runWidth, blockHeight ) ) );
+      Pel *dst = dstBuf.buf + w + h * dstBuf.stride;
 
       if ( yFrac == 0 )
       {
-        m_if.filterHor( compID, (Pel*) refBuf.buf, refBuf.stride, dstBuf.buf + w + h * dstBuf.stride, dstBuf.stride, blockWidth, blockHeight, xFrac, !bi, chFmt, clpRng );
+        m_if.filterHor( compID, (Pel*) refBuf.buf, refBuf.stride, dst, dstBuf.stride, runWidth, blockHeight, xFrac, !bi, chFmt, clpRng );
       }
       else if ( xFrac == 0 )
       {
-        m_if.filterVer( compID, (Pel*) refBuf.buf, refBuf.stride, dstBuf.buf + w + h * dstBuf.stride, dstBuf.stride, blockWidth, blockHeight, yFrac, true, !bi, chFmt, clpRng );
+        m_if.filterVer( compID, (Pel*) refBuf.buf, refBuf.stride, dst, dstBuf.stride, runWidth, blockHeight, yFrac, true, !bi, chFmt, clpRng );
+      }
+      else if ( isLuma( compID ) && runWidth == 4 && blockHeight == 4 )
+      {
+        m_if.filter4x4( refBuf.buf, refBuf.stride, dst, dstBuf.stride, xFrac, yFrac, !bi, clpRng );
       }
       else
       {
-        m_if.filterHor( compID, (Pel*) refBuf.buf - ((vFilterSize>>1) -1)*refBuf.stride, refBuf.stride, tmpBuf.buf, tmpBuf.stride, blockWidth, blockHeight+vFilterSize-1, xFrac, false,      chFmt, clpRng);
+        m_if.filterHor( compID, (Pel*) refBuf.buf - ((vFilterSize>>1) -1)*refBuf.stride, refBuf.stride, tmpBuf.buf, tmpBuf.stride, runWidth, blockHeight+vFilterSize-1, xFrac, false,      chFmt, clpRng);
         JVET_J0090_SET_CACHE_ENABLE( false );
-        m_if.filterVer( compID, tmpBuf.buf + ((vFilterSize>>1) -1)*tmpBuf.stride, tmpBuf.stride, dstBuf.buf + w + h * dstBuf.stride, dstBuf.stride, blockWidth, blockHeight, yFrac, false, !bi, chFmt, clpRng);
+        m_if.filterVer( compID, tmpBuf.buf + ((vFilterSize>>1) -1)*tmpBuf.stride, tmpBuf.stride, dst, dstBuf.stride, runWidth, blockHeight, yFrac, false, !bi, chFmt, clpRng);
         JVET_J0090_SET_CACHE_ENABLE( true );
       }
+
+      i = iEnd;
     }
   }
 }
@@ -152,6 +152,8 @@ InterpolationFilter::InterpolationFilter()
   m_filterCopy[1][0]   = filterCopy<true, false>;
   m_filterCopy[1][1]   = filterCopy<true, true>;
 
+  m_filter4x4[0]       = filter4x4<false>;
+  m_filter4x4[1]       = filter4x4<true>;
 }
 
 
@@ -352,6 +354,34 @@ void InterpolationFilter::filter(const ClpRng& clpRng, Pel const *src, int srcSt
   }
 }
 
+/**
+ * \brief Apply the separable 8-tap luma filter to a 4x4 block in both directions
+ *
+ * \param clpRng     Clipping range
+ * \param src        Pointer to the top-left source sample of the block
+ * \param srcStride  Stride of source samples
+ * \param dst        Pointer to destination samples
+ * \param dstStride  Stride of destination samples
+ * \param coeffH     Pointer to horizontal filter taps
+ * \param coeffV     Pointer to vertical filter taps
+ */
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// !!! NOTE !!!
+//
+//  This is the scalar version of the function.
+//  If you change the functionality here, consider to switch off the SIMD implementation of this function.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template<bool isLast>
+void InterpolationFilter::filter4x4( const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, TFilterCoeff const *coeffH, TFilterCoeff const *coeffV )
+{
+  Pel tmp[( 4 + NTAPS_LUMA - 1 ) * 4];
+
+  filter<NTAPS_LUMA, false, true, false >( clpRng, src - ( ( NTAPS_LUMA >> 1 ) - 1 ) * srcStride, srcStride, tmp, 4, 4, 4 + NTAPS_LUMA - 1, coeffH );
+  filter<NTAPS_LUMA, true, false, isLast>( clpRng, tmp + ( ( NTAPS_LUMA >> 1 ) - 1 ) * 4, 4, dst, dstStride, 4, 4, coeffV );
+}
+
 /**
  * \brief Filter a block of samples (horizontal)
  *
@@ -502,6 +532,26 @@ void InterpolationFilter::filterVer( const ComponentID compID, Pel const *src, i
   }
 }
 
+/**
+ * \brief Filter a 4x4 block of Luma samples at a fractional position in both directions
+ *
+ * \param  src        Pointer to the top-left source sample of the block
+ * \param  srcStride  Stride of source samples
+ * \param  dst        Pointer to destination samples
+ * \param  dstStride  Stride of destination samples
+ * \param  fracX      Horizontal fractional sample offset, must be non-zero
+ * \param  fracY      Vertical fractional sample offset, must be non-zero
+ * \param  isLast     Flag indicating whether it is the last filtering operation
+ * \param  clpRng     Clipping range
+ */
+void InterpolationFilter::filter4x4( Pel const *src, int srcStride, Pel *dst, int dstStride, int fracX, int fracY, bool isLast, const ClpRng& clpRng )
+{
+  CHECK( fracX <= 0 || fracX >= ( LUMA_INTERPOLATION_FILTER_SUB_SAMPLE_POSITIONS << VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE ), "Invalid fraction" );
+  CHECK( fracY <= 0 || fracY >= ( LUMA_INTERPOLATION_FILTER_SUB_SAMPLE_POSITIONS << VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE ), "Invalid fraction" );
+
+  m_filter4x4[isLast]( clpRng, src, srcStride, dst, dstStride, m_lumaFilter[fracX], m_lumaFilter[fracY] );
+}
+
 /**
  * \brief turn on SIMD fuc
  *
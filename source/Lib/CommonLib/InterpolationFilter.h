@@ -63,6 +63,9 @@ public:
   template<int N, bool isVertical, bool isFirst, bool isLast>
   static void filter(const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, TFilterCoeff const *coeff);
 
+  template<bool isLast>
+  static void filter4x4( const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, TFilterCoeff const *coeffH, TFilterCoeff const *coeffV );
+
   template<int N>
   void filterHor(const ClpRng& clpRng, Pel const* src, int srcStride, Pel *dst, int dstStride, int width, int height,               bool isLast, TFilterCoeff const *coeff);
   template<int N>
@@ -79,6 +82,7 @@ public:
   void( *m_filterHor[3][2][2] )( const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, TFilterCoeff const *coeff );
   void( *m_filterVer[3][2][2] )( const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, TFilterCoeff const *coeff );
   void( *m_filterCopy[2][2] )  ( const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height );
+  void( *m_filter4x4[2] )      ( const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, TFilterCoeff const *coeffH, TFilterCoeff const *coeffV );
 
   void initInterpolationFilter( bool enable );
 #ifdef TARGET_SIMD_X86
@@ -89,6 +93,7 @@ public:
 
   void filterHor(const ComponentID compID, Pel const* src, int srcStride, Pel *dst, int dstStride, int width, int height, int frac,               bool isLast, const ChromaFormat fmt, const ClpRng& clpRng );
   void filterVer(const ComponentID compID, Pel const* src, int srcStride, Pel *dst, int dstStride, int width, int height, int frac, bool isFirst, bool isLast, const ChromaFormat fmt, const ClpRng& clpRng );
+  void filter4x4(                          Pel const* src, int srcStride, Pel *dst, int dstStride, int fracX, int fracY,                 bool isLast,                          const ClpRng& clpRng );
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
   void cacheAssign( CacheModel *cache ) { m_cacheModel = cache; }
 #endif
@@ -85,6 +85,37 @@ const uint8_t IntraPrediction::m_aucIntraFilter[MAX_NUM_CHANNEL_TYPE][MAX_INTRA_
   }
 };
 
+// ====================================================================================================================
+// Static functions
+// ====================================================================================================================
+
+static void lmLumaDownsampleCore( const Pel* pRecSrc, int iRecStride, Pel* pDst, int iDstStride, int width, int height )
+{
+  for( int j = 0; j < height; j++ )
+  {
+    for( int i = 0; i < width; i++ )
+    {
+      pDst[i] = ( pRecSrc[2 * i             ] * 2 + pRecSrc[2 * i + 1             ] + pRecSrc[2 * i - 1             ]
+                + pRecSrc[2 * i + iRecStride] * 2 + pRecSrc[2 * i + 1 + iRecStride] + pRecSrc[2 * i - 1 + iRecStride]
+                + 4 ) >> 3;
+    }
+
+    pDst    += iDstStride;
+    pRecSrc += iRecStride << 1;
+  }
+}
+
+static void lmAccumulateCore( const Pel* pLuma, const Pel* pChroma, int num, int& x, int& y, int& xx, int& xy )
+{
+  for( int n = 0; n < num; n++ )
+  {
+    x  += pLuma[n];
+    y  += pChroma[n];
+    xx += pLuma[n] * pLuma[n];
+    xy += pLuma[n] * pChroma[n];
+  }
+}
+
 // ====================================================================================================================
 // Constructor / destructor / initialize
 // ====================================================================================================================
@@ -102,6 +133,13 @@ IntraPrediction::IntraPrediction()
   }
 
   m_piTemp = nullptr;
+
+  m_lmLumaDownsample = lmLumaDownsampleCore;
+  m_lmAccumulate     = lmAccumulateCore;
+
+#if ENABLE_SIMD_OPT_INTRA && defined( TARGET_SIMD_X86 )
+  initIntraPredictionX86();
+#endif
 }
 
 IntraPrediction::~IntraPrediction()
@@ -336,8 +374,22 @@ void IntraPrediction::predIntraChromaLM(const ComponentID compID, PelBuf &piPred
   xGetLMParameters(pu, compID, chromaArea, a, b, iShift);
 
   ////// final prediction
-  piPred.copyFrom(Temp);
-  piPred.linearTransform(a, iShift, b, true, pu.cs->slice->clpRng(compID));
+  const ClpRng& clpRng = pu.cs->slice->clpRng( compID );
+#if ENABLE_SIMD_OPT_BUFFER && defined(TARGET_SIMD_X86)
+  if( ( piPred.width & 7 ) == 0 )
+  {
+    g_pelBufOP.linTf8( Temp.buf, Temp.stride, piPred.buf, piPred.stride, piPred.width, piPred.height, a, iShift, b, clpRng, true );
+  }
+  else if( ( piPred.width & 3 ) == 0 )
+  {
+    g_pelBufOP.linTf4( Temp.buf, Temp.stride, piPred.buf, piPred.stride, piPred.width, piPred.height, a, iShift, b, clpRng, true );
+  }
+  else
+#endif
+  {
+    piPred.copyFrom(Temp);
+    piPred.linearTransform(a, iShift, b, true, clpRng);
+  }
 }
 
 void IntraPrediction::xFilterGroup(Pel* pMulDst[], int i, Pel const * const piSrc, int iRecStride, bool bAboveAvaillable, bool bLeftAvaillable)
@@ -1204,18 +1256,11 @@ void IntraPrediction::xGetLumaRecPixels(const PredictionUnit &pu, CompArea chrom
     pDst  = pDst0    - iDstStride;
     piSrc = pRecSrc0 - iRecStride2;
 
-    for( int i = 0; i < uiCWidth; i++ )
+    m_lmLumaDownsample( piSrc, iRecStride, pDst, iDstStride, uiCWidth, 1 );
+
+    if( !bLeftAvaillable )
     {
-      if( i == 0 && !bLeftAvaillable )
-      {
-        pDst[i] = ( piSrc[2 * i] + piSrc[2 * i + iRecStride] + 1 ) >> 1;
-      }
-      else
-      {
-        pDst[i] = ( ( ( piSrc[2 * i             ] * 2 ) + piSrc[2 * i - 1             ] + piSrc[2 * i + 1             ] )
-                  + ( ( piSrc[2 * i + iRecStride] * 2 ) + piSrc[2 * i - 1 + iRecStride] + piSrc[2 * i + 1 + iRecStride] )
-                  + 4 ) >> 3;
-      }
+      pDst[0] = ( piSrc[0] + piSrc[iRecStride] + 1 ) >> 1;
     }
   }
 
@@ -1237,24 +1282,17 @@ void IntraPrediction::xGetLumaRecPixels(const PredictionUnit &pu, CompArea chrom
 
 
   // inner part from reconstructed picture buffer
-  for( int j = 0; j < uiCHeight; j++ )
+  m_lmLumaDownsample( pRecSrc0, iRecStride, pDst0, iDstStride, uiCWidth, uiCHeight );
+
+  if( !bLeftAvaillable )
   {
-    for( int i = 0; i < uiCWidth; i++ )
+    for( int j = 0; j < uiCHeight; j++ )
     {
-      if( i == 0 && !bLeftAvaillable )
-      {
-        pDst0[i] = ( pRecSrc0[2 * i] + pRecSrc0[2 * i + iRecStride] + 1 ) >> 1;
-      }
-      else
-      {
-        pDst0[i] = ( pRecSrc0[2 * i             ] * 2 + pRecSrc0[2 * i + 1             ] + pRecSrc0[2 * i - 1             ]
-                   + pRecSrc0[2 * i + iRecStride] * 2 + pRecSrc0[2 * i + 1 + iRecStride] + pRecSrc0[2 * i - 1 + iRecStride]
-                   + 4 ) >> 3;
-      }
-    }
+      pDst0[0] = ( pRecSrc0[0] + pRecSrc0[iRecStride] + 1 ) >> 1;
 
-    pDst0    += iDstStride;
-    pRecSrc0 += iRecStride2;
+      pDst0    += iDstStride;
+      pRecSrc0 += iRecStride2;
+    }
   }
 }
 
@@ -1333,14 +1371,21 @@ void IntraPrediction::xGetLMParameters(const PredictionUnit &pu, const Component
 
   if( bAboveAvaillable )
   {
-    for( int j = 0; j < numSteps; j++ )
+    if( minStep * uiCWidth == minDim )
+    {
+      m_lmAccumulate( pSrc, pCur, numSteps, x, y, xx, xy );
+    }
+    else
     {
-      int idx = ( j * minStep * uiCWidth ) / minDim;
+      for( int j = 0; j < numSteps; j++ )
+      {
+        int idx = ( j * minStep * uiCWidth ) / minDim;
 
-      x  += pSrc[idx];
-      y  += pCur[idx];
-      xx += pSrc[idx] * pSrc[idx];
-      xy += pSrc[idx] * pCur[idx];
+        x  += pSrc[idx];
+        y  += pCur[idx];
+        xx += pSrc[idx] * pSrc[idx];
+        xy += pSrc[idx] * pCur[idx];
+      }
     }
 
     iCountShift = g_aucLog2[minDim / minStep];
@@ -105,6 +105,15 @@ protected:
 
   void xFilterGroup               ( Pel* pMulDst[], int i, Pel const* const piSrc, int iRecStride, bool bAboveAvaillable, bool bLeftAvaillable);
   void xGetLMParameters(const PredictionUnit &pu, const ComponentID compID, const CompArea& chromaArea, int& a, int& b, int& iShift);
+
+  void ( *m_lmLumaDownsample )( const Pel* pRecSrc, int iRecStride, Pel* pDst, int iDstStride, int width, int height );
+  void ( *m_lmAccumulate )    ( const Pel* pLuma, const Pel* pChroma, int num, int& x, int& y, int& xx, int& xy );
+
+#ifdef TARGET_SIMD_X86
+  void initIntraPredictionX86();
+  template <X86_VEXT vext>
+  void _initIntraPredictionX86();
+#endif
 public:
   IntraPrediction();
   virtual ~IntraPrediction();
@@ -140,5 +140,35 @@ struct MotionInfo
   }
 };
 
+/// motion information of a coded picture as read by the temporal motion vector prediction, packed into 16 bytes
+/// (the 18 bit vector components cover the vector range in 1/16 sample units)
+struct PackedMotionInfo
+{
+  PackedMotionInfo() : hor0( 0 ), ver0( 0 ), ref0( NOT_VALID ), slice( 0 ), inter( 0 ), hor1( 0 ), ver1( 0 ), ref1( NOT_VALID ) { }
+  explicit PackedMotionInfo( const MotionInfo& mi )
+    : hor0( mi.mv[0].hor ), ver0( mi.mv[0].ver ), ref0( mi.refIdx[0] ), slice( mi.sliceIdx ), inter( mi.isInter ? 1 : 0 )
+    , hor1( mi.mv[1].hor ), ver1( mi.mv[1].ver ), ref1( mi.refIdx[1] )
+  {
+    CHECK( hor0 != mi.mv[0].hor || ver0 != mi.mv[0].ver || hor1 != mi.mv[1].hor || ver1 != mi.mv[1].ver, "Motion vector exceeds the range of the packed motion field" );
+  }
+
+  bool     isInter ()                const { return inter != 0; }
+  uint16_t sliceIdx()                const { return uint16_t( slice ); }
+  int      refIdx  ( const int l )   const { return l ? int( ref1 ) : int( ref0 ); }
+  Mv       mv      ( const int l )   const { return l ? Mv( int( hor1 ), int( ver1 ) ) : Mv( int( hor0 ), int( ver0 ) ); }
+
+private:
+  int64_t  hor0  : 18;
+  int64_t  ver0  : 18;
+  int64_t  ref0  :  8;
+  int64_t  slice : 17;
+  int64_t  inter :  2;
+  int64_t  hor1  : 18;
+  int64_t  ver1  : 18;
+  int64_t  ref1  :  8;
+};
+
+static_assert( sizeof( PackedMotionInfo ) == 16, "PackedMotionInfo is expected to occupy 16 bytes" );
+
 
 #endif // __MOTIONINFO__
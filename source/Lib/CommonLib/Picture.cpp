@@ -716,6 +716,7 @@ Picture::Picture()
 #endif
   cs                   = nullptr;
   m_bIsBorderExtended  = false;
+  m_bSkipBorderExtension = false;
   usedByCurr           = false;
   longTerm             = false;
   reconstructed        = false;
@@ -737,6 +738,13 @@ void Picture::create(const ChromaFormat &_chromaFormat, const Size &size, const
   UnitArea::operator=( UnitArea( _chromaFormat, Area( Position{ 0, 0 }, size ) ) );
   margin            =  _margin;
   const Area a      = Area( Position(), size );
+
+  // the planes are allocated by role (the decoder has no original) and reused across pictures of equal format
+  for( uint32_t t = 0; t < NUM_PIC_TYPES; t++ )
+  {
+    M_BUFS( 0, t ).setPool( &g_picBufferPool, t );
+  }
+
   M_BUFS( 0, PIC_RECONSTRUCTION ).create( _chromaFormat, a, _maxCUSize, _margin, MEMORY_ALIGN_DEF_SIZE );
 
   if( !_decoder )
@@ -811,9 +819,12 @@ void Picture::createTempBuffers( const unsigned _maxCUSize )
   for( int jId = 0; jId < scheduler.getNumPicInstances(); jId++ )
 #endif
   {
+    M_BUFS( jId, PIC_PREDICTION                   ).setPool( &g_picBufferPool, PIC_PREDICTION );
+    M_BUFS( jId, PIC_RESIDUAL                     ).setPool( &g_picBufferPool, PIC_RESIDUAL );
     M_BUFS( jId, PIC_PREDICTION                   ).create( chromaFormat, a,   _maxCUSize );
     M_BUFS( jId, PIC_RESIDUAL                     ).create( chromaFormat, a,   _maxCUSize );
 #if ENABLE_SPLIT_PARALLELISM
+    if( jId > 0 ) M_BUFS( jId, PIC_RECONSTRUCTION ).setPool( &g_picBufferPool, PIC_RECONSTRUCTION );
     if( jId > 0 ) M_BUFS( jId, PIC_RECONSTRUCTION ).create( chromaFormat, Y(), _maxCUSize, margin, MEMORY_ALIGN_DEF_SIZE );
 #endif
   }
@@ -839,6 +850,13 @@ void Picture::destroyTempBuffers()
   if( cs ) cs->rebindPicBufs();
 }
 
+void Picture::reportBufferMemory()
+{
+  static const char *const roleNames[NUM_PIC_BUF_ROLES] = { "reco", "orig", "pred", "resi", "org-resi", "coeffs" };
+
+  g_picBufferPool.report( roleNames, NUM_PIC_BUF_ROLES );
+}
+
        PelBuf     Picture::getOrigBuf(const CompArea &blk)        { return getBuf(blk,  PIC_ORIGINAL); }
 const CPelBuf     Picture::getOrigBuf(const CompArea &blk)  const { return getBuf(blk,  PIC_ORIGINAL); }
        PelUnitBuf Picture::getOrigBuf(const UnitArea &unit)       { return getBuf(unit, PIC_ORIGINAL); }
@@ -887,6 +905,11 @@ void Picture::finalInit( const SPS& sps, const PPS& pps )
   const int          iWidth = sps.getPicWidthInLumaSamples();
   const int          iHeight = sps.getPicHeightInLumaSamples();
 
+#if COEFF_LEVELS_16BIT && !RExt__HIGH_BIT_DEPTH_SUPPORT
+  CHECK( sps.getMaxLog2TrDynamicRange( CHANNEL_TYPE_LUMA ) > 15 || sps.getMaxLog2TrDynamicRange( CHANNEL_TYPE_CHROMA ) > 15,
+         "Coefficient levels do not fit into 16 bit, compile with COEFF_LEVELS_16BIT=0 or RExt__HIGH_BIT_DEPTH_SUPPORT=1" );
+#endif
+
   if( cs )
   {
     cs->initStructData();
@@ -989,7 +1012,7 @@ void Picture::finishCtuPart( const UnitArea& ctuArea )
 
 void Picture::extendPicBorder()
 {
-  if ( m_bIsBorderExtended )
+  if ( m_bIsBorderExtended || m_bSkipBorderExtension )
   {
     return;
   }
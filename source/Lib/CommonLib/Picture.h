@@ -186,6 +186,8 @@ struct Picture : public UnitArea
   void createTempBuffers( const unsigned _maxCUSize );
   void destroyTempBuffers();
 
+  static void reportBufferMemory();
+
          PelBuf     getOrigBuf(const CompArea &blk);
   const CPelBuf     getOrigBuf(const CompArea &blk) const;
          PelUnitBuf getOrigBuf(const UnitArea &unit);
@@ -224,6 +226,8 @@ struct Picture : public UnitArea
 
   int  getPOC()                               const { return poc; }
   void setBorderExtension( bool bFlag)              { m_bIsBorderExtended = bFlag;}
+  bool getBorderExtension()                   const { return m_bIsBorderExtended; }
+  void setSkipBorderExtension( bool bFlag )         { m_bSkipBorderExtension = bFlag; }
   Pel* getOrigin( const PictureType &type, const ComponentID compID ) const;
 
   int           getSpliceIdx(uint32_t idx) const { return m_spliceIdx[idx]; }
@@ -233,6 +237,7 @@ struct Picture : public UnitArea
 
 public:
   bool m_bIsBorderExtended;
+  bool m_bSkipBorderExtension;    ///< the border is never padded, the motion compensation clamps its fetches instead
   bool referenced;
   bool reconstructed;
   bool neededForOutput;
@@ -139,7 +139,7 @@ Quant::~Quant()
 
 #if HEVC_USE_SIGN_HIDING
 // To minimize the distortion only. No rate is considered.
-void Quant::xSignBitHidingHDQ( TCoeff* pQCoef, const TCoeff* pCoef, TCoeff* deltaU, const CoeffCodingContext& cctx, const int maxLog2TrDynamicRange )
+void Quant::xSignBitHidingHDQ( TCoeffLevel* pQCoef, const TCoeff* pCoef, TCoeff* deltaU, const CoeffCodingContext& cctx, const int maxLog2TrDynamicRange )
 {
   const uint32_t width     = cctx.width();
   const uint32_t height    = cctx.height();
@@ -283,8 +283,8 @@ void Quant::dequant(const TransformUnit &tu,
   const CompArea       &area               = tu.blocks[compID];
   const uint32_t            uiWidth            = area.width;
   const uint32_t            uiHeight           = area.height;
-  const TCoeff   *const piQCoef            = tu.getCoeffs(compID).buf;
-        TCoeff   *const piCoef             = dstCoeff.buf;
+  const TCoeffLevel    *const piQCoef     = tu.getCoeffs(compID).buf;
+        TCoeff         *const piCoef      = dstCoeff.buf;
   const uint32_t            numSamplesInBlock  = uiWidth * uiHeight;
   const int             maxLog2TrDynamicRange = sps->getMaxLog2TrDynamicRange(toChannelType(compID));
   const TCoeff          transformMinimum   = -(1 << maxLog2TrDynamicRange);
@@ -715,7 +715,7 @@ void Quant::quant(TransformUnit &tu, const ComponentID &compID, const CCoeffBuf
   const int channelBitDepth = sps.getBitDepth(toChannelType(compID));
 
   const CCoeffBuf &piCoef   = pSrc;
-        CoeffBuf   piQCoef  = tu.getCoeffs(compID);
+        LevelBuf   piQCoef  = tu.getCoeffs(compID);
 
   const bool useTransformSkip      = tu.transformSkip[compID];
   const int  maxLog2TrDynamicRange = sps.getMaxLog2TrDynamicRange(toChannelType(compID));
@@ -793,7 +793,7 @@ void Quant::quant(TransformUnit &tu, const ComponentID &compID, const CCoeffBuf
       uiAbsSum += quantisedMagnitude;
       const TCoeff quantisedCoefficient = quantisedMagnitude * iSign;
 
-      piQCoef.buf[uiBlockPos] = Clip3<TCoeff>( entropyCodingMinimum, entropyCodingMaximum, quantisedCoefficient );
+      piQCoef.buf[uiBlockPos] = TCoeffLevel( Clip3<TCoeff>( entropyCodingMinimum, entropyCodingMaximum, quantisedCoefficient ) );
     } // for n
 #if HEVC_USE_SIGN_HIDING
     if( cctx.signHiding() && uiWidth>=4 && uiHeight>=4 )
@@ -883,7 +883,7 @@ bool Quant::xNeedRDOQ(TransformUnit &tu, const ComponentID &compID, const CCoeff
 }
 
 
-void Quant::transformSkipQuantOneSample(TransformUnit &tu, const ComponentID &compID, const TCoeff &resiDiff, TCoeff &coeff, const uint32_t &uiPos, const QpParam &cQP, const bool bUseHalfRoundingPoint)
+void Quant::transformSkipQuantOneSample(TransformUnit &tu, const ComponentID &compID, const TCoeff &resiDiff, TCoeffLevel &coeff, const uint32_t &uiPos, const QpParam &cQP, const bool bUseHalfRoundingPoint)
 {
   const SPS           &sps = *tu.cs->sps;
   const CompArea      &rect                           = tu.blocks[compID];
@@ -948,7 +948,7 @@ void Quant::transformSkipQuantOneSample(TransformUnit &tu, const ComponentID &co
 
   const TCoeff entropyCodingMinimum = -(1 << maxLog2TrDynamicRange);
   const TCoeff entropyCodingMaximum =  (1 << maxLog2TrDynamicRange) - 1;
-  coeff = Clip3<TCoeff>( entropyCodingMinimum, entropyCodingMaximum, quantisedCoefficient );
+  coeff = TCoeffLevel( Clip3<TCoeff>( entropyCodingMinimum, entropyCodingMaximum, quantisedCoefficient ) );
 }
 
 void Quant::invTrSkipDeQuantOneSample(TransformUnit &tu, const ComponentID &compID, const TCoeff &inSample, Pel &reconSample, const uint32_t &uiPos, const QpParam &cQP)
@@ -72,6 +72,19 @@ struct coeffGroupRDStats
 // Static functions
 // ====================================================================================================================
 
+static void preQuantCore( const TCoeff* src, Intermediate_Int* levelDouble, uint32_t* maxAbsLevel, const int numCoeff, const int quantCoeff, const int iQBits, const TCoeff entropyCodingMaximum )
+{
+  const Intermediate_Int maxLevelDouble = std::numeric_limits<Intermediate_Int>::max() - ( Intermediate_Int( 1 ) << ( iQBits - 1 ) );
+
+  for( int n = 0; n < numCoeff; n++ )
+  {
+    const int64_t tmpLevel = int64_t( abs( src[n] ) ) * quantCoeff;
+
+    levelDouble[n] = ( Intermediate_Int ) std::min<int64_t>( tmpLevel, maxLevelDouble );
+    maxAbsLevel[n] = std::min<uint32_t>( uint32_t( entropyCodingMaximum ), uint32_t( ( levelDouble[n] + ( Intermediate_Int( 1 ) << ( iQBits - 1 ) ) ) >> iQBits ) );
+  }
+}
+
 // ====================================================================================================================
 // QuantRDOQ class member functions
 // ====================================================================================================================
@@ -85,6 +98,12 @@ QuantRDOQ::QuantRDOQ( const Quant* other ) : Quant( other )
 #if HEVC_USE_SCALING_LISTS
   xInitScalingList( rdoq );
 #endif
+
+  m_preQuant = preQuantCore;
+
+#if ENABLE_SIMD_OPT_QUANT && defined( TARGET_SIMD_X86 )
+  initQuantRDOQX86();
+#endif
 }
 
 QuantRDOQ::~QuantRDOQ()
@@ -109,9 +128,7 @@ inline uint32_t QuantRDOQ::xGetCodedLevel( double&            rd64CodedCost,
                                        Intermediate_Int   lLevelDouble,
                                        uint32_t               uiMaxAbsLevel,
                                        const BinFracBits* fracBitsSig,
-                                       const BinFracBits& fracBitsPar,
-                                       const BinFracBits& fracBitsGt1,
-                                       const BinFracBits& fracBitsGt2,
+                                       const int*         levelRates,
                                        uint16_t             ui16AbsGoRice,
                                        int                iQBits,
                                        double             errorScale,
@@ -146,7 +163,7 @@ inline uint32_t QuantRDOQ::xGetCodedLevel( double&            rd64CodedCost,
   for( int uiAbsLevel  = uiMaxAbsLevel; uiAbsLevel >= uiMinAbsLevel ; uiAbsLevel-- )
   {
     double dErr         = double( lLevelDouble  - ( Intermediate_Int(uiAbsLevel) << iQBits ) );
-    double dCurrCost    = dErr * dErr * errorScale + xGetICost( xGetICRate( uiAbsLevel, fracBitsPar, fracBitsGt1, fracBitsGt2, ui16AbsGoRice, useLimitedPrefixLength, maxLog2TrDynamicRange ) );
+    double dCurrCost    = dErr * dErr * errorScale + xGetICost( xGetICRate( uiAbsLevel, levelRates, ui16AbsGoRice, useLimitedPrefixLength, maxLog2TrDynamicRange ) );
     dCurrCost          += dCurrCostSig;
 
     if( dCurrCost < rd64CodedCost )
@@ -160,21 +177,48 @@ inline uint32_t QuantRDOQ::xGetCodedLevel( double&            rd64CodedCost,
   return uiBestAbsLevel;
 }
 
+/** Get the rates of the context coded level bins for a context offset
+ * \param cctx coefficient coding context of the current TU
+ * \param fracBits fractional bits of the context states
+ * \param ctxOffset context offset of the parity, greater1 and greater2 flags
+ * \returns table of the context coded level rates, indexed by the level (1 to 4) or by 5 + parity for escape-coded levels
+ *
+ * The context states do not change during RDOQ of one TU, so the table is derived once per context offset and TU.
+ */
+inline const int* QuantRDOQ::xGetLevelRates( const CoeffCodingContext& cctx, const FracBitsAccess& fracBits, const uint8_t ctxOffset )
+{
+  int* levelRates = m_levelRates[ctxOffset];
+
+  if( !( m_levelRatesValid & ( 1u << ctxOffset ) ) )
+  {
+    const BinFracBits fracBitsPar = fracBits.getFracBitsArray( cctx.parityCtxIdAbs  ( ctxOffset ) );
+    const BinFracBits fracBitsGt1 = fracBits.getFracBitsArray( cctx.greater1CtxIdAbs( ctxOffset ) );
+    const BinFracBits fracBitsGt2 = fracBits.getFracBitsArray( cctx.greater2CtxIdAbs( ctxOffset ) );
+
+    levelRates[0] = 0;
+    levelRates[1] = fracBitsPar.intBits[0] + fracBitsGt1.intBits[0];
+    levelRates[2] = fracBitsPar.intBits[1] + fracBitsGt1.intBits[0];
+    levelRates[3] = fracBitsPar.intBits[0] + fracBitsGt1.intBits[1] + fracBitsGt2.intBits[0];
+    levelRates[4] = fracBitsPar.intBits[1] + fracBitsGt1.intBits[1] + fracBitsGt2.intBits[0];
+    levelRates[5] = fracBitsPar.intBits[0] + fracBitsGt1.intBits[1] + fracBitsGt2.intBits[1];
+    levelRates[6] = fracBitsPar.intBits[1] + fracBitsGt1.intBits[1] + fracBitsGt2.intBits[1];
+
+    m_levelRatesValid |= 1u << ctxOffset;
+  }
+
+  return levelRates;
+}
+
 /** Calculates the cost for specific absolute transform level
  * \param uiAbsLevel scaled quantized level
- * \param ui16CtxNumOne current ctxInc for coeff_abs_level_greater1 (1st bin of coeff_abs_level_minus1 in AVC)
- * \param ui16CtxNumAbs current ctxInc for coeff_abs_level_greater2 (remaining bins of coeff_abs_level_minus1 in AVC)
+ * \param levelRates rates of the context coded level bins (see xGetLevelRates)
  * \param ui16AbsGoRice Rice parameter for coeff_abs_level_minus3
- * \param c1Idx
- * \param c2Idx
  * \param useLimitedPrefixLength
  * \param maxLog2TrDynamicRange
  * \returns cost of given absolute transform level
  */
 inline int QuantRDOQ::xGetICRate( const uint32_t         uiAbsLevel,
-                                  const BinFracBits& fracBitsPar,
-                                  const BinFracBits& fracBitsGt1,
-                                  const BinFracBits& fracBitsGt2,
+                                  const int*         levelRates,
                                   const uint16_t       ui16AbsGoRice,
                                   const bool         useLimitedPrefixLength,
                                   const int          maxLog2TrDynamicRange  ) const
@@ -218,31 +262,11 @@ inline int QuantRDOQ::xGetICRate( const uint32_t         uiAbsLevel,
       iRate += ( threshold + length + 1 - ui16AbsGoRice + length ) << SCALE_BITS;
     }
 
-    iRate += fracBitsPar.intBits[( uiAbsLevel - 1 ) & 1];
-    iRate += fracBitsGt1.intBits[1];
-    iRate += fracBitsGt2.intBits[1];
-  }
-  else if( uiAbsLevel == 1 )
-  {
-    iRate += fracBitsPar.intBits[0];
-    iRate += fracBitsGt1.intBits[0];
-  }
-  else if( uiAbsLevel == 2 )
-  {
-    iRate += fracBitsPar.intBits[1];
-    iRate += fracBitsGt1.intBits[0];
+    iRate += levelRates[5 + ( ( uiAbsLevel - 1 ) & 1 )];
   }
-  else if( uiAbsLevel == 3 )
+  else if( uiAbsLevel > 0 )
   {
-    iRate += fracBitsPar.intBits[0];
-    iRate += fracBitsGt1.intBits[1];
-    iRate += fracBitsGt2.intBits[0];
-  }
-  else if( uiAbsLevel == 4 )
-  {
-    iRate += fracBitsPar.intBits[1];
-    iRate += fracBitsGt1.intBits[1];
-    iRate += fracBitsGt2.intBits[0];
+    iRate += levelRates[uiAbsLevel];
   }
   else
   {
@@ -497,7 +521,7 @@ void QuantRDOQ::quant(TransformUnit &tu, const ComponentID &compID, const CCoeff
   const uint32_t uiHeight       = rect.height;
 
   const CCoeffBuf &piCoef   = pSrc;
-        CoeffBuf   piQCoef  = tu.getCoeffs(compID);
+        LevelBuf   piQCoef  = tu.getCoeffs(compID);
 
   const bool useTransformSkip      = tu.transformSkip[compID];
 
@@ -576,7 +600,7 @@ void QuantRDOQ::xRateDistOptQuant(TransformUnit &tu, const ComponentID &compID,
 #endif
 
   const TCoeff *plSrcCoeff = pSrc.buf;
-        TCoeff *piDstCoeff = tu.getCoeffs(compID).buf;
+   TCoeffLevel *piDstCoeff = tu.getCoeffs(compID).buf;
 
   double *pdCostCoeff  = m_pdCostCoeff;
   double *pdCostSig    = m_pdCostSig;
@@ -637,6 +661,39 @@ void QuantRDOQ::xRateDistOptQuant(TransformUnit &tu, const ComponentID &compID,
 #endif
   const int    iCGSizeM1      = (1 << cctx.log2CGSize()) - 1;
 
+  //===== pre-quantization of all coefficients =====
+#if HEVC_USE_SCALING_LISTS
+  if( enableScalingLists )
+  {
+    for( uint32_t uiBlkPos = 0; uiBlkPos < uiMaxNumCoeff; uiBlkPos++ )
+    {
+      preQuantCore( plSrcCoeff + uiBlkPos, m_levelDouble + uiBlkPos, m_maxAbsLevel + uiBlkPos, 1, piQCoef[uiBlkPos], iQBits, entropyCodingMaximum );
+    }
+  }
+  else
+  {
+    m_preQuant( plSrcCoeff, m_levelDouble, m_maxAbsLevel, uiMaxNumCoeff, defaultQuantisationCoefficient, iQBits, entropyCodingMaximum );
+  }
+#else
+  m_preQuant( plSrcCoeff, m_levelDouble, m_maxAbsLevel, uiMaxNumCoeff, quantisationCoefficient, iQBits, entropyCodingMaximum );
+#endif
+
+  {
+    uint32_t uiMaxAbsLevelOr = 0;
+    for( uint32_t uiBlkPos = 0; uiBlkPos < uiMaxNumCoeff; uiBlkPos++ )
+    {
+      uiMaxAbsLevelOr |= m_maxAbsLevel[uiBlkPos];
+    }
+    if( !uiMaxAbsLevelOr )
+    {
+      // all levels quantize to zero, nothing to optimize
+      memset( piDstCoeff, 0, sizeof( TCoeffLevel ) * uiMaxNumCoeff );
+      return;
+    }
+  }
+
+  m_levelRatesValid = 0;
+
   int     iCGLastScanPos      = -1;
   double  d64BaseCost         = 0;
   int     iLastScanPos        = -1;
@@ -669,18 +726,15 @@ void QuantRDOQ::xRateDistOptQuant(TransformUnit &tu, const ComponentID &compID,
 
       // set coeff
 #if HEVC_USE_SCALING_LISTS
-      const int    quantisationCoefficient = (enableScalingLists) ? piQCoef   [uiBlkPos]               : defaultQuantisationCoefficient;
 #if HM_QTBT_AS_IN_JEM_QUANT
       const double errorScale              = (enableScalingLists) ? pdErrScale[uiBlkPos]               : defaultErrorScale;
 #else
       const double errorScale              = (enableScalingLists) ? pdErrScale[uiBlkPos] * blkErrScale : defaultErrorScale;
 #endif
 #endif
-      const int64_t  tmpLevel                = int64_t(abs(plSrcCoeff[ uiBlkPos ])) * quantisationCoefficient;
-
-      const Intermediate_Int lLevelDouble  = (Intermediate_Int)std::min<int64_t>(tmpLevel, std::numeric_limits<Intermediate_Int>::max() - (Intermediate_Int(1) << (iQBits - 1)));
+      const Intermediate_Int lLevelDouble  = m_levelDouble[ uiBlkPos ];
 
-      uint32_t uiMaxAbsLevel        = std::min<uint32_t>(uint32_t(entropyCodingMaximum), uint32_t((lLevelDouble + (Intermediate_Int(1) << (iQBits - 1))) >> iQBits));
+      uint32_t uiMaxAbsLevel        = m_maxAbsLevel[ uiBlkPos ];
 
       const double dErr         = double( lLevelDouble );
       pdCostCoeff0[ iScanPos ]  = dErr * dErr * errorScale;
@@ -711,19 +765,15 @@ void QuantRDOQ::xRateDistOptQuant(TransformUnit &tu, const ComponentID &compID,
         }
         uint32_t    uiLevel;
         uint8_t ctxOffset     = cctx.ctxOffsetAbs     ();
-        uint32_t    uiParCtx      = cctx.parityCtxIdAbs   ( ctxOffset );
-        uint32_t    uiGt1Ctx      = cctx.greater1CtxIdAbs ( ctxOffset );
-        uint32_t    uiGt2Ctx      = cctx.greater2CtxIdAbs ( ctxOffset );
-        uint32_t    uiGoRiceParam = cctx.GoRiceParAbs     ( iScanPos, piDstCoeff );
+        // the Rice parameter is only needed for non-zero levels
+        uint32_t    uiGoRiceParam = uiMaxAbsLevel ? cctx.GoRiceParAbs( iScanPos, piDstCoeff ) : 0;
 
-        const BinFracBits fracBitsPar = fracBits.getFracBitsArray( uiParCtx );
-        const BinFracBits fracBitsGt1 = fracBits.getFracBitsArray( uiGt1Ctx );
-        const BinFracBits fracBitsGt2 = fracBits.getFracBitsArray( uiGt2Ctx );
+        const int* levelRates = xGetLevelRates( cctx, fracBits, ctxOffset );
 
         if( iScanPos == iLastScanPos )
         {
           uiLevel = xGetCodedLevel( pdCostCoeff[ iScanPos ], pdCostCoeff0[ iScanPos ], pdCostSig[ iScanPos ],
-                                    lLevelDouble, uiMaxAbsLevel, nullptr, fracBitsPar, fracBitsGt1, fracBitsGt2, uiGoRiceParam, iQBits, errorScale, 1, extendedPrecision, maxLog2TrDynamicRange );
+                                    lLevelDouble, uiMaxAbsLevel, nullptr, levelRates, uiGoRiceParam, iQBits, errorScale, 1, extendedPrecision, maxLog2TrDynamicRange );
         }
         else
         {
@@ -731,7 +781,7 @@ void QuantRDOQ::xRateDistOptQuant(TransformUnit &tu, const ComponentID &compID,
 
           const BinFracBits fracBitsSig = fracBits.getFracBitsArray( ctxIdSig );
           uiLevel = xGetCodedLevel( pdCostCoeff[ iScanPos ], pdCostCoeff0[ iScanPos ], pdCostSig[ iScanPos ],
-                                    lLevelDouble, uiMaxAbsLevel, &fracBitsSig, fracBitsPar, fracBitsGt1, fracBitsGt2, uiGoRiceParam, iQBits, errorScale, 0, extendedPrecision, maxLog2TrDynamicRange );
+                                    lLevelDouble, uiMaxAbsLevel, &fracBitsSig, levelRates, uiGoRiceParam, iQBits, errorScale, 0, extendedPrecision, maxLog2TrDynamicRange );
 #if HEVC_USE_SIGN_HIDING
           sigRateDelta[ uiBlkPos ] = fracBitsSig.intBits[1] - fracBitsSig.intBits[0];
 #endif
@@ -746,13 +796,13 @@ void QuantRDOQ::xRateDistOptQuant(TransformUnit &tu, const ComponentID &compID,
 
         if( uiLevel > 0 )
         {
-          int rateNow              = xGetICRate( uiLevel,   fracBitsPar, fracBitsGt1, fracBitsGt2, uiGoRiceParam, extendedPrecision, maxLog2TrDynamicRange );
-          rateIncUp   [ uiBlkPos ] = xGetICRate( uiLevel+1, fracBitsPar, fracBitsGt1, fracBitsGt2, uiGoRiceParam, extendedPrecision, maxLog2TrDynamicRange ) - rateNow;
-          rateIncDown [ uiBlkPos ] = xGetICRate( uiLevel-1, fracBitsPar, fracBitsGt1, fracBitsGt2, uiGoRiceParam, extendedPrecision, maxLog2TrDynamicRange ) - rateNow;
+          int rateNow              = xGetICRate( uiLevel,   levelRates, uiGoRiceParam, extendedPrecision, maxLog2TrDynamicRange );
+          rateIncUp   [ uiBlkPos ] = xGetICRate( uiLevel+1, levelRates, uiGoRiceParam, extendedPrecision, maxLog2TrDynamicRange ) - rateNow;
+          rateIncDown [ uiBlkPos ] = xGetICRate( uiLevel-1, levelRates, uiGoRiceParam, extendedPrecision, maxLog2TrDynamicRange ) - rateNow;
         }
         else // uiLevel == 0
         {
-          rateIncUp   [ uiBlkPos ] = fracBitsPar.intBits[ 0 ] + fracBitsGt1.intBits[ 0 ];
+          rateIncUp   [ uiBlkPos ] = levelRates[ 1 ];
         }
 #endif
         piDstCoeff[ uiBlkPos ] = uiLevel;
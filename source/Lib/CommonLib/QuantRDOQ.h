@@ -68,6 +68,15 @@ public:
   // quantization
   void quant                ( TransformUnit &tu, const ComponentID &compID, const CCoeffBuf &pSrc, TCoeff &uiAbsSum, const QpParam &cQP, const Ctx& ctx );
 
+protected:
+  void ( *m_preQuant )      ( const TCoeff* src, Intermediate_Int* levelDouble, uint32_t* maxAbsLevel, const int numCoeff, const int quantCoeff, const int iQBits, const TCoeff entropyCodingMaximum );
+
+#if ENABLE_SIMD_OPT_QUANT && defined( TARGET_SIMD_X86 )
+  void initQuantRDOQX86();
+  template <X86_VEXT vext>
+  void _initQuantRDOQX86();
+#endif
+
 private:
 #if HEVC_USE_SCALING_LISTS
   double* xGetErrScaleCoeff              ( uint32_t list, uint32_t sizeX, uint32_t sizeY, int qp ) { return m_errScale             [sizeX][sizeY][list][qp]; };  //!< get Error Scale Coefficent
@@ -88,9 +97,7 @@ private:
                               Intermediate_Int   lLevelDouble,
                               uint32_t               uiMaxAbsLevel,
                               const BinFracBits* fracBitsSig,
-                              const BinFracBits& fracBitsPar,
-                              const BinFracBits& fracBitsGt1,
-                              const BinFracBits& fracBitsGt2,
+                              const int*         levelRates,
                               uint16_t             ui16AbsGoRice,
                               int                iQBits,
                               double             errorScale,
@@ -98,12 +105,11 @@ private:
                               bool               useLimitedPrefixLength,
                               const int          maxLog2TrDynamicRange ) const;
   inline int xGetICRate     ( const uint32_t         uiAbsLevel,
-                              const BinFracBits& fracBitsPar,
-                              const BinFracBits& fracBitsGt1,
-                              const BinFracBits& fracBitsGt2,
+                              const int*         levelRates,
                               const uint16_t       ui16AbsGoRice,
                               const bool         useLimitedPrefixLength,
                               const int          maxLog2TrDynamicRange  ) const;
+  inline const int* xGetLevelRates( const CoeffCodingContext& cctx, const FracBitsAccess& fracBits, const uint8_t ctxOffset );
   inline double xGetRateLast         ( const int* lastBitsX, const int* lastBitsY,
                                        unsigned        PosX, unsigned   PosY                              ) const;
 
@@ -122,6 +128,11 @@ private:
   double  m_errScaleNoScalingList[SCALING_LIST_SIZE_NUM][SCALING_LIST_SIZE_NUM][SCALING_LIST_NUM][SCALING_LIST_REM_NUM]; ///< array of quantization matrix coefficient 4x4
 #endif
   // temporary buffers for RDOQ
+  Intermediate_Int m_levelDouble [MAX_TU_SIZE * MAX_TU_SIZE];
+  uint32_t m_maxAbsLevel      [MAX_TU_SIZE * MAX_TU_SIZE];
+  // level rates (without sign and remainder bins) per absolute level context offset, filled on demand per TU
+  int      m_levelRates       [RDOQ_NUM_CTX_OFFSETS][RDOQ_NUM_LEVEL_RATES];
+  uint32_t m_levelRatesValid;
   double m_pdCostCoeff        [MAX_TU_SIZE * MAX_TU_SIZE];
   double m_pdCostSig          [MAX_TU_SIZE * MAX_TU_SIZE];
   double m_pdCostCoeff0       [MAX_TU_SIZE * MAX_TU_SIZE];
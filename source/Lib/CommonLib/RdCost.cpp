@@ -49,6 +49,7 @@
 
 
 FpDistFunc RdCost::m_afpDistortFunc[DF_TOTAL_FUNCTIONS] = { nullptr, };
+FpDistFuncX4 RdCost::m_fpSADx4 = nullptr;
 
 RdCost::RdCost()
 {
@@ -113,6 +114,8 @@ void RdCost::init()
   m_afpDistortFunc[DF_SAD24  ] = RdCost::xGetSAD24;
   m_afpDistortFunc[DF_SAD48  ] = RdCost::xGetSAD48;
 
+  m_fpSADx4                     = RdCost::xGetSADx4;
+
   m_afpDistortFunc[DF_HAD    ] = RdCost::xGetHADs;
   m_afpDistortFunc[DF_HAD2   ] = RdCost::xGetHADs;
   m_afpDistortFunc[DF_HAD4   ] = RdCost::xGetHADs;
@@ -405,6 +408,29 @@ Distortion RdCost::getDistPart( const CPelBuf &org, const CPelBuf &cur, int bitD
   }
 }
 
+/** reconstructs reco = clip( pred + resi ) and returns the same value as getDistPart( org, reco, ..., DF_SSE ),
+ *  with the distortion summed up while the reconstructed samples are written
+ */
+Distortion RdCost::getRecoDistPart( PelBuf &reco, const CPelBuf &pred, const CPelBuf &resi, const CPelBuf &org, const ClpRng &clpRng, int bitDepth, const ComponentID compID )
+{
+  if( DISTORTION_PRECISION_ADJUSTMENT( bitDepth ) != 0 )
+  {
+    reco.reconstruct( pred, resi, clpRng );
+    return getDistPart( org, reco, bitDepth, compID, DF_SSE );
+  }
+
+  const Distortion dist = reco.reconstructSSE( pred, resi, org, clpRng );
+
+  if( isChroma( compID ) )
+  {
+    return ( ( Distortion ) ( m_distortionWeight[ MAP_CHROMA( compID ) ] * dist ) );
+  }
+  else
+  {
+    return dist;
+  }
+}
+
 // ====================================================================================================================
 // Distortion functions
 // ====================================================================================================================
@@ -476,6 +502,65 @@ Distortion RdCost::xGetSAD( const DistParam& rcDtParam )
   return ( uiSum >> distortionShift );
 }
 
+void RdCost::xGetSADx4( const DistParam& rcDtParam, const Pel* const cur[4], Distortion dist[4] )
+{
+  if( rcDtParam.applyWeight || rcDtParam.useMR )
+  {
+    DistParam dp = rcDtParam;
+    for( int k = 0; k < 4; k++ )
+    {
+      dp.cur.buf = cur[k];
+      dist[k]    = dp.distFunc( dp );
+    }
+    return;
+  }
+
+  const Pel* piOrg           = rcDtParam.org.buf;
+  const Pel* piCur[4]        = { cur[0], cur[1], cur[2], cur[3] };
+  const int  iCols           = rcDtParam.org.width;
+  const int  iRows           = rcDtParam.org.height;
+  const int  iSubShift       = rcDtParam.subShift;
+  const int  iSubStep        = ( 1 << iSubShift );
+  const int  iStrideCur      = rcDtParam.cur.stride * iSubStep;
+  const int  iStrideOrg      = rcDtParam.org.stride * iSubStep;
+  const uint32_t distortionShift = DISTORTION_PRECISION_ADJUSTMENT(rcDtParam.bitDepth);
+
+  Distortion uiSum[4] = { 0, 0, 0, 0 };
+
+  for( int iY = 0; iY < iRows; iY += iSubStep )
+  {
+    for( int n = 0; n < iCols; n++ )
+    {
+      const Pel org = piOrg[n];
+      uiSum[0] += abs( org - piCur[0][n] );
+      uiSum[1] += abs( org - piCur[1][n] );
+      uiSum[2] += abs( org - piCur[2][n] );
+      uiSum[3] += abs( org - piCur[3][n] );
+    }
+    piOrg += iStrideOrg;
+    for( int k = 0; k < 4; k++ )
+    {
+      piCur[k] += iStrideCur;
+    }
+
+    // check every 8 rows whether all candidates are already worse than the best one
+    if( ( ( iY >> iSubShift ) & 7 ) == 7 && iY + iSubStep < iRows )
+    {
+      const Distortion maxDist = rcDtParam.maximumDistortionForEarlyExit;
+      if( ( ( uiSum[0] << iSubShift ) >> distortionShift ) > maxDist && ( ( uiSum[1] << iSubShift ) >> distortionShift ) > maxDist &&
+          ( ( uiSum[2] << iSubShift ) >> distortionShift ) > maxDist && ( ( uiSum[3] << iSubShift ) >> distortionShift ) > maxDist )
+      {
+        break;
+      }
+    }
+  }
+
+  for( int k = 0; k < 4; k++ )
+  {
+    dist[k] = ( uiSum[k] << iSubShift ) >> distortionShift;
+  }
+}
+
 Distortion RdCost::xGetSAD4( const DistParam& rcDtParam )
 {
   if ( rcDtParam.applyWeight )
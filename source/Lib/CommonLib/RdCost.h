@@ -58,6 +58,7 @@ class EncCfg;
 
 // for function pointer
 typedef Distortion (*FpDistFunc) (const DistParam&);
+typedef void       (*FpDistFuncX4) (const DistParam&, const Pel* const cur[4], Distortion dist[4]);
 
 // ====================================================================================================================
 // Class definition
@@ -102,6 +103,7 @@ private:
   // for distortion
 
   static FpDistFunc       m_afpDistortFunc[DF_TOTAL_FUNCTIONS]; // [eDFunc]
+  static FpDistFuncX4     m_fpSADx4;
   CostMode                m_costMode;
   double                  m_distortionWeight[MAX_NUM_COMPONENT]; // only chroma values are used.
   double                  m_dLambda;
@@ -156,6 +158,10 @@ public:
   void           setDistParam( DistParam &rcDP, const CPelBuf &org, const CPelBuf &cur, int bitDepth, ComponentID compID, bool useHadamard = false );
   void           setDistParam( DistParam &rcDP, const Pel* pOrg, const Pel* piRefY, int iOrgStride, int iRefStride, int bitDepth, ComponentID compID, int width, int height, int subShiftMode = 0, int step = 1, bool useHadamard = false );
 
+  /// SAD of the original block of rcDP against four candidate blocks with the stride of rcDP.cur. Once all four partial
+  /// sums exceed rcDP.maximumDistortionForEarlyExit the calculation stops, the returned values are then only lower bounds.
+  void           getSADx4                 ( const DistParam &rcDP, const Pel* const cur[4], Distortion dist[4] ) const { m_fpSADx4( rcDP, cur, dist ); }
+
   double         getMotionLambda          ( bool bIsTransquantBypass ) { return m_dLambdaMotionSAD[(bIsTransquantBypass && m_costMode==COST_MIXED_LOSSLESS_LOSSY_CODING)?1:0]; }
   void           selectMotionLambda       ( bool bIsTransquantBypass ) { m_motionLambda = getMotionLambda( bIsTransquantBypass ); }
   void           setPredictor             ( const Mv& rcMv )
@@ -233,6 +239,7 @@ private:
   static Distortion xGetSAD48         ( const DistParam& pcDtParam );
 
   static Distortion xGetSAD_full      ( const DistParam& pcDtParam );
+  static void       xGetSADx4         ( const DistParam& pcDtParam, const Pel* const cur[4], Distortion dist[4] );
 
   static Distortion xGetMRSAD         ( const DistParam& pcDtParam );
   static Distortion xGetMRSAD4        ( const DistParam& pcDtParam );
@@ -266,6 +273,8 @@ private:
   static Distortion xGetSAD_SIMD    ( const DistParam& pcDtParam );
   template< int iWidth, X86_VEXT vext >
   static Distortion xGetSAD_NxN_SIMD( const DistParam& pcDtParam );
+  template< X86_VEXT vext >
+  static void       xGetSADx4_SIMD  ( const DistParam& pcDtParam, const Pel* const cur[4], Distortion dist[4] );
 
   template< typename Torg, typename Tcur, X86_VEXT vext >
   static Distortion xGetHADs_SIMD   ( const DistParam& pcDtParam );
@@ -278,6 +287,7 @@ public:
 #else
   Distortion   getDistPart( const CPelBuf &org, const CPelBuf &cur, int bitDepth, const ComponentID compID, DFunc eDFunc );
 #endif
+  Distortion   getRecoDistPart( PelBuf &reco, const CPelBuf &pred, const CPelBuf &resi, const CPelBuf &org, const ClpRng &clpRng, int bitDepth, const ComponentID compID );
 
 };// END CLASS DEFINITION RdCost
 
@@ -311,7 +311,7 @@ void TrQuant::invTransformNxN( TransformUnit &tu, const ComponentID &compID, Pel
   {
     // where should this logic go?
     const bool rotateResidual = TU::isNonTransformedResidualRotated(tu, compID);
-    const CCoeffBuf pCoeff    = tu.getCoeffs(compID);
+    const CLevelBuf pCoeff    = tu.getCoeffs(compID);
 
     for (uint32_t y = 0, coefficientIndex = 0; y < uiHeight; y++)
     {
@@ -589,7 +589,7 @@ void TrQuant::transformNxN(TransformUnit &tu, const ComponentID &compID, const Q
   const uint32_t uiHeight       = rect.height;
 
   const CPelBuf resiBuf     = cs.getResiBuf(rect);
-        CoeffBuf rpcCoeff   = tu.getCoeffs(compID);
+        LevelBuf rpcCoeff   = tu.getCoeffs(compID);
 
   RDPCMMode rdpcmMode = RDPCM_OFF;
   rdpcmNxN(tu, compID, cQP, uiAbsSum, rdpcmMode);
@@ -664,7 +664,7 @@ void TrQuant::applyForwardRDPCM(TransformUnit &tu, const ComponentID &compID, co
   const uint32_t uiSizeMinus1   = (uiWidth * uiHeight) - 1;
 
   const CPelBuf pcResidual  = tu.cs->getResiBuf(tu.blocks[compID]);
-  const CoeffBuf pcCoeff    = tu.getCoeffs(compID);
+  const LevelBuf pcCoeff    = tu.getCoeffs(compID);
 
   uint32_t uiX = 0;
   uint32_t uiY = 0;
@@ -742,7 +742,7 @@ void TrQuant::rdpcmNxN(TransformUnit &tu, const ComponentID &compID, const QpPar
 
     RDPCMMode bestMode = NUMBER_OF_RDPCM_MODES;
     TCoeff    bestAbsSum = std::numeric_limits<TCoeff>::max();
-    TCoeff    bestCoefficients[MAX_TU_SIZE * MAX_TU_SIZE];
+    TCoeffLevel bestCoefficients[MAX_TU_SIZE * MAX_TU_SIZE];
 
     for (uint32_t modeIndex = 0; modeIndex < NUMBER_OF_RDPCM_MODES; modeIndex++)
     {
@@ -759,7 +759,7 @@ void TrQuant::rdpcmNxN(TransformUnit &tu, const ComponentID &compID, const QpPar
 
         if (mode != RDPCM_OFF)
         {
-          CoeffBuf(bestCoefficients, uiWidth, uiHeight).copyFrom(tu.getCoeffs(compID));
+          LevelBuf(bestCoefficients, uiWidth, uiHeight).copyFrom(tu.getCoeffs(compID));
         }
       }
     }
@@ -769,7 +769,7 @@ void TrQuant::rdpcmNxN(TransformUnit &tu, const ComponentID &compID, const QpPar
 
     if (rdpcmMode != RDPCM_OFF) //the TU is re-transformed and quantized if DPCM_OFF is returned, so there is no need to preserve it here
     {
-      tu.getCoeffs(compID).copyFrom(CoeffBuf(bestCoefficients, uiWidth, uiHeight));
+      tu.getCoeffs(compID).copyFrom(LevelBuf(bestCoefficients, uiWidth, uiHeight));
     }
   }
 
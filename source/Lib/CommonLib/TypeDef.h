@@ -240,6 +240,10 @@
 #define RExt__HIGH_BIT_DEPTH_SUPPORT                      0 ///< 0 (default) use data type definitions for 8-10 bit video, 1 = use larger data types to allow for up to 16-bit video (originally developed as part of N0188)
 #endif
 
+#ifndef COEFF_LEVELS_16BIT
+#define COEFF_LEVELS_16BIT                                1 ///< 1 (default) store the coefficient levels of the transform units in 16 bit (without RExt__HIGH_BIT_DEPTH_SUPPORT only), 0 = store them as TCoeff
+#endif
+
 // SIMD optimizations
 #define SIMD_ENABLE                                       1
 #define ENABLE_SIMD_OPT                                 ( SIMD_ENABLE && !RExt__HIGH_BIT_DEPTH_SUPPORT )    ///< SIMD optimizations, no impact on RD performance
@@ -248,6 +252,8 @@
 #define ENABLE_SIMD_OPT_DIST                            ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the distortion calculations(SAD,SSE,HADAMARD), no impact on RD performance
 #define ENABLE_SIMD_OPT_AFFINE_ME                       ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for affine ME, no impact on RD performance
 #define ENABLE_SIMD_OPT_ALF                             ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for ALF
+#define ENABLE_SIMD_OPT_QUANT                           ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the RDOQ pre-quantization, no impact on RD performance
+#define ENABLE_SIMD_OPT_INTRA                           ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the cross-component linear model prediction, no impact on RD performance
 // End of SIMD optimizations
 
 
@@ -325,6 +331,12 @@ typedef       int             Intermediate_Int;  ///< used as intermediate value
 typedef       uint32_t            Intermediate_UInt; ///< used as intermediate value in calculations
 #endif
 
+#if COEFF_LEVELS_16BIT && !RExt__HIGH_BIT_DEPTH_SUPPORT
+typedef       int16_t           TCoeffLevel;       ///< coefficient level of a transform unit, the transforms and the quantisation work on TCoeff
+#else
+typedef       TCoeff          TCoeffLevel;       ///< coefficient level of a transform unit, the transforms and the quantisation work on TCoeff
+#endif
+
 typedef       uint64_t          SplitSeries;       ///< used to encoded the splits that caused a particular CU size
 
 typedef       uint64_t        Distortion;        ///< distortion measurement
@@ -1250,7 +1262,11 @@ public:
 template<typename T>
 class dynamic_cache
 {
+  // the elements are allocated in blocks, which are only released together with the cache
+  static const size_t BLOCK_SIZE = 64;
+
   std::vector<T*> m_cache;
+  std::vector<T*> m_blocks;
 #if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
   int64_t         m_cacheId;
 #endif
@@ -1272,13 +1288,14 @@ public:
 
   void deleteEntries()
   {
-    for( auto &p : m_cache )
+    for( auto &p : m_blocks )
     {
-      delete p;
+      delete[] p;
       p = nullptr;
     }
 
-    m_cache.clear();
+    m_blocks.clear();
+    m_cache .clear();
   }
 
   T* get()
@@ -1296,7 +1313,20 @@ public:
     }
     else
     {
-      ret = new T;
+      // grow by a whole block, the elements not returned go into the cache
+      T* block = new T[BLOCK_SIZE];
+      m_blocks.push_back( block );
+
+      for( size_t i = BLOCK_SIZE - 1; i > 0; i-- )
+      {
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
+        block[i].cacheId   = m_cacheId;
+        block[i].cacheUsed = true;
+#endif
+        m_cache.push_back( block + i );
+      }
+
+      ret = block;
     }
 
 #if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
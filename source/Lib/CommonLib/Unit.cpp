@@ -463,7 +463,7 @@ void TransformUnit::initData()
 
 }
 
-void TransformUnit::init(TCoeff **coeffs, Pel **pcmbuf)
+void TransformUnit::init(TCoeffLevel **coeffs, Pel **pcmbuf)
 {
   uint32_t numBlocks = getNumberValidTBlocks(*cs->pcv);
 
@@ -485,7 +485,7 @@ TransformUnit& TransformUnit::operator=(const TransformUnit& other)
 
     uint32_t area = blocks[i].area();
 
-    if (m_coeffs[i] && other.m_coeffs[i] && m_coeffs[i] != other.m_coeffs[i]) memcpy(m_coeffs[i], other.m_coeffs[i], sizeof(TCoeff) * area);
+    if (m_coeffs[i] && other.m_coeffs[i] && m_coeffs[i] != other.m_coeffs[i]) memcpy(m_coeffs[i], other.m_coeffs[i], sizeof(TCoeffLevel) * area);
     if (m_pcmbuf[i] && other.m_pcmbuf[i] && m_pcmbuf[i] != other.m_pcmbuf[i]) memcpy(m_pcmbuf[i], other.m_pcmbuf[i], sizeof(Pel   ) * area);
 
     cbf[i]           = other.cbf[i];
@@ -508,7 +508,7 @@ void TransformUnit::copyComponentFrom(const TransformUnit& other, const Componen
 
   uint32_t area = blocks[i].area();
 
-  if (m_coeffs[i] && other.m_coeffs[i] && m_coeffs[i] != other.m_coeffs[i]) memcpy(m_coeffs[i], other.m_coeffs[i], sizeof(TCoeff) * area);
+  if (m_coeffs[i] && other.m_coeffs[i] && m_coeffs[i] != other.m_coeffs[i]) memcpy(m_coeffs[i], other.m_coeffs[i], sizeof(TCoeffLevel) * area);
   if (m_pcmbuf[i] && other.m_pcmbuf[i] && m_pcmbuf[i] != other.m_pcmbuf[i]) memcpy(m_pcmbuf[i], other.m_pcmbuf[i], sizeof(Pel   ) * area);
 
   cbf[i]           = other.cbf[i];
@@ -526,8 +526,8 @@ void TransformUnit::copyComponentFrom(const TransformUnit& other, const Componen
   }
 }
 
-       CoeffBuf TransformUnit::getCoeffs(const ComponentID id)       { return  CoeffBuf(m_coeffs[id], blocks[id]); }
-const CCoeffBuf TransformUnit::getCoeffs(const ComponentID id) const { return CCoeffBuf(m_coeffs[id], blocks[id]); }
+       LevelBuf TransformUnit::getCoeffs(const ComponentID id)       { return  LevelBuf(m_coeffs[id], blocks[id]); }
+const CLevelBuf TransformUnit::getCoeffs(const ComponentID id) const { return CLevelBuf(m_coeffs[id], blocks[id]); }
 
        PelBuf   TransformUnit::getPcmbuf(const ComponentID id)       { return  PelBuf  (m_pcmbuf[id], blocks[id]); }
 const CPelBuf   TransformUnit::getPcmbuf(const ComponentID id) const { return CPelBuf  (m_pcmbuf[id], blocks[id]); }
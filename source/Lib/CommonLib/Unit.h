@@ -417,13 +417,13 @@ struct TransformUnit : public UnitArea
   unsigned       idx;
   TransformUnit *next;
 
-  void init(TCoeff **coeffs, Pel **pcmbuf);
+  void init(TCoeffLevel **coeffs, Pel **pcmbuf);
 
   TransformUnit& operator=(const TransformUnit& other);
   void copyComponentFrom  (const TransformUnit& other, const ComponentID compID);
 
-         CoeffBuf getCoeffs(const ComponentID id);
-  const CCoeffBuf getCoeffs(const ComponentID id) const;
+         LevelBuf getCoeffs(const ComponentID id);
+  const CLevelBuf getCoeffs(const ComponentID id) const;
          PelBuf   getPcmbuf(const ComponentID id);
   const CPelBuf   getPcmbuf(const ComponentID id) const;
 
@@ -433,8 +433,8 @@ struct TransformUnit : public UnitArea
 
 #endif
 private:
-  TCoeff *m_coeffs[ MAX_NUM_TBLOCKS ];
-  Pel    *m_pcmbuf[ MAX_NUM_TBLOCKS ];
+  TCoeffLevel *m_coeffs[ MAX_NUM_TBLOCKS ];
+  Pel         *m_pcmbuf[ MAX_NUM_TBLOCKS ];
 };
 
 // ---------------------------------------------------------------------------
@@ -1000,18 +1000,18 @@ bool PU::getColocatedMVP(const PredictionUnit &pu, const RefPicList &eRefPicList
 
   RefPicList eColRefPicList = slice.getCheckLDC() ? eRefPicList : RefPicList(slice.getColFromL0Flag());
 
-  const MotionInfo& mi = pColPic->cs->getMotionInfo( pos );
+  const PackedMotionInfo mi = pColPic->cs->getColMotionInfo( pos );
 
-  if( !mi.isInter )
+  if( !mi.isInter() )
   {
     return false;
   }
-  int iColRefIdx = mi.refIdx[eColRefPicList];
+  int iColRefIdx = mi.refIdx( eColRefPicList );
 
   if (iColRefIdx < 0)
   {
     eColRefPicList = RefPicList(1 - eColRefPicList);
-    iColRefIdx = mi.refIdx[eColRefPicList];
+    iColRefIdx = mi.refIdx( eColRefPicList );
 
     if (iColRefIdx < 0)
     {
@@ -1023,7 +1023,7 @@ bool PU::getColocatedMVP(const PredictionUnit &pu, const RefPicList &eRefPicList
 
   for( const auto s : pColPic->slices )
   {
-    if( s->getIndependentSliceIdx() == mi.sliceIdx )
+    if( s->getIndependentSliceIdx() == mi.sliceIdx() )
     {
       pColSlice = s;
       break;
@@ -1044,7 +1044,7 @@ bool PU::getColocatedMVP(const PredictionUnit &pu, const RefPicList &eRefPicList
 
 
   // Scale the vector.
-  Mv cColMv = mi.mv[eColRefPicList];
+  Mv cColMv = mi.mv( eColRefPicList );
 
   if (bIsCurrRefLongTerm /*|| bIsColRefLongTerm*/)
   {
@@ -2012,18 +2012,17 @@ void PU::setAllAffineMv( PredictionUnit& pu, Mv affLT, Mv affRT, Mv affLB, RefPi
 }
 
 static bool deriveScaledMotionTemporal( const Slice&      slice,
-                                        const Position&   colPos,
+                                        const PackedMotionInfo& mi,
                                         const Picture*    pColPic,
                                         const RefPicList  eCurrRefPicList,
                                         Mv&         cColMv,
                                         const RefPicList  eFetchRefPicList)
 {
-  const MotionInfo &mi = pColPic->cs->getMotionInfo(colPos);
   const Slice *pColSlice = nullptr;
 
   for (const auto &pSlice : pColPic->slices)
   {
-    if (pSlice->getIndependentSliceIdx() == mi.sliceIdx)
+    if (pSlice->getIndependentSliceIdx() == mi.sliceIdx())
     {
       pColSlice = pSlice;
       break;
@@ -2047,12 +2046,12 @@ static bool deriveScaledMotionTemporal( const Slice&      slice,
   // Grab motion and do necessary scaling.{{
   iCurrPOC = slice.getPOC();
 
-  int iColRefIdx = mi.refIdx[eColRefPicList];
+  int iColRefIdx = mi.refIdx(eColRefPicList);
 
   if (iColRefIdx < 0 && (slice.getCheckLDC() || bAllowMirrorMV))
   {
     eColRefPicList = RefPicList(1 - eColRefPicList);
-    iColRefIdx = mi.refIdx[eColRefPicList];
+    iColRefIdx = mi.refIdx(eColRefPicList);
 
     if (iColRefIdx < 0)
     {
@@ -2069,7 +2068,7 @@ static bool deriveScaledMotionTemporal( const Slice&      slice,
     ///////////////////////////////////////////////////////////////
     iCurrRefPOC = slice.getRefPic(eCurrRefPicList, 0)->getPOC();
     // Scale the vector.
-    cColMv = mi.mv[eColRefPicList];
+    cColMv = mi.mv(eColRefPicList);
     //pcMvFieldSP[2*iPartition + eCurrRefPicList].getMv();
     // Assume always short-term for now
     iScale = xGetDistScaleFactor(iCurrPOC, iCurrRefPOC, iColPOC, iColRefPOC);
@@ -2197,15 +2196,15 @@ bool PU::getInterMergeSubPuMvpCand(const PredictionUnit &pu, MergeCtx& mrgCtx, b
   centerPos = Position{ PosType(centerPos.x & mask), PosType(centerPos.y & mask) };
 
   // derivation of center motion parameters from the collocated CU
-  const MotionInfo &mi = pColPic->cs->getMotionInfo(centerPos);
+  const PackedMotionInfo mi = pColPic->cs->getColMotionInfo(centerPos);
 
-  if (mi.isInter)
+  if (mi.isInter())
   {
     for (unsigned currRefListId = 0; currRefListId < (bBSlice ? 2 : 1); currRefListId++)
     {
       RefPicList  currRefPicList = RefPicList(currRefListId);
 
-      if (deriveScaledMotionTemporal(slice, centerPos, pColPic, currRefPicList, cColMv, fetchRefPicList))
+      if (deriveScaledMotionTemporal(slice, mi, pColPic, currRefPicList, cColMv, fetchRefPicList))
       {
         // set as default, for further motion vector field spanning
         mrgCtx.mvFieldNeighbours[(count << 1) + currRefListId].setMvField(cColMv, 0);
@@ -2251,19 +2250,19 @@ bool PU::getInterMergeSubPuMvpCand(const PredictionUnit &pu, MergeCtx& mrgCtx, b
 
       colPos = Position{ PosType(colPos.x & mask), PosType(colPos.y & mask) };
 
-      const MotionInfo &colMi = pColPic->cs->getMotionInfo(colPos);
+      const PackedMotionInfo colMi = pColPic->cs->getColMotionInfo(colPos);
 
       MotionInfo mi;
 
       mi.isInter = true;
       mi.sliceIdx = slice.getIndependentSliceIdx();
 
-      if (colMi.isInter)
+      if (colMi.isInter())
       {
         for (unsigned currRefListId = 0; currRefListId < (bBSlice ? 2 : 1); currRefListId++)
         {
           RefPicList currRefPicList = RefPicList(currRefListId);
-          if (deriveScaledMotionTemporal(slice, colPos, pColPic, currRefPicList, cColMv, fetchRefPicList))
+          if (deriveScaledMotionTemporal(slice, colMi, pColPic, currRefPicList, cColMv, fetchRefPicList))
           {
             mi.refIdx[currRefListId] = 0;
             mi.mv[currRefListId] = cColMv;
@@ -2721,7 +2720,7 @@ uint32_t TU::getNumNonZeroCoeffsNonTS( const TransformUnit& tu, const bool bLuma
       if( isChroma( tu.blocks[i].compID ) && !bChroma ) continue;
 
       uint32_t area = tu.blocks[i].area();
-      const TCoeff* coeff = tu.getCoeffs( ComponentID( i ) ).buf;
+      const TCoeffLevel* coeff = tu.getCoeffs( ComponentID( i ) ).buf;
       for( uint32_t j = 0; j < area; j++ )
       {
         count += coeff[j] != 0;
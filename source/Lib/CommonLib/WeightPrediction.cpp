@@ -41,6 +41,7 @@
 #include "InterpolationFilter.h"
 #include "WeightPrediction.h"
 #include "CodingStructure.h"
+#include "Buffer.h"
 
 
 static inline Pel weightBidir( int w0, Pel P0, int w1, Pel P1, int round, int shift, int offset, const ClpRng& clpRng)
@@ -191,6 +192,24 @@ void WeightPrediction::addWeightBi(const CPelUnitBuf          &pcYuvSrc0,
     const uint32_t iSrc1Stride = pcYuvSrc1.bufs[compID].stride;
     const uint32_t iDstStride =  rpcYuvDst.bufs[compID].stride;
 
+#if ENABLE_SIMD_OPT_BUFFER && defined(TARGET_SIMD_X86)
+    if( ( iWidth & 3 ) == 0 )
+    {
+      // fold the internal offsets of both sources and the WP offset into a single additive term
+      const int offsetAll = ( w0 + w1 ) * IF_INTERNAL_OFFS + round + ( offset << ( shift - 1 ) );
+
+      if( ( iWidth & 7 ) == 0 )
+      {
+        g_pelBufOP.wghtAvg8( pSrc0, iSrc0Stride, pSrc1, iSrc1Stride, pDst, iDstStride, iWidth, iHeight, w0, w1, shift, offsetAll, clpRng );
+      }
+      else
+      {
+        g_pelBufOP.wghtAvg4( pSrc0, iSrc0Stride, pSrc1, iSrc1Stride, pDst, iDstStride, iWidth, iHeight, w0, w1, shift, offsetAll, clpRng );
+      }
+      continue;
+    }
+
+#endif
     for (int y = iHeight - 1; y >= 0; y--)
     {
       // do it in batches of 4 (partial unroll)
@@ -242,6 +261,28 @@ void  WeightPrediction::addWeightUni(const CPelUnitBuf          &pcYuvSrc0,
     const int  iHeight      = rpcYuvDst.bufs[compID].height;
     const int  iWidth       = rpcYuvDst.bufs[compID].width;
 
+#if ENABLE_SIMD_OPT_BUFFER && defined(TARGET_SIMD_X86)
+    if( ( iWidth & 3 ) == 0 )
+    {
+      // the unit weight case is mapped onto the weighted kernel with w = 1 and the reduced shift
+      const bool weighted  = w0 != 1 << wp0[compID].shift;
+      const int  w         = weighted ? w0    : 1;
+      const int  shiftUni  = weighted ? shift : shiftNum;
+      const int  roundUni  = shiftUni > 0 ? ( 1 << ( shiftUni - 1 ) ) : 0;
+      const int  roundAll  = w * IF_INTERNAL_OFFS + roundUni;
+
+      if( ( iWidth & 7 ) == 0 )
+      {
+        g_pelBufOP.wghtUni8( pSrc0, iSrc0Stride, pDst, iDstStride, iWidth, iHeight, w, shiftUni, roundAll, offset, clpRng );
+      }
+      else
+      {
+        g_pelBufOP.wghtUni4( pSrc0, iSrc0Stride, pDst, iDstStride, iWidth, iHeight, w, shiftUni, roundAll, offset, clpRng );
+      }
+      continue;
+    }
+
+#endif
     if (w0 != 1 << wp0[compID].shift)
     {
       const int  round = (shift > 0) ? (1 << (shift - 1)) : 0;
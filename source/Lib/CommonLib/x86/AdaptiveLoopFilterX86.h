@@ -771,12 +771,302 @@ static void simdFilter7x7Blk( AlfClassifier** classifier, const PelUnitBuf &recD
   }
 }
 
+#ifdef USE_AVX512
+template<X86_VEXT vext>
+static void simdDeriveClassificationBlk_AVX512( AlfClassifier** classifier, int** laplacian[NUM_DIRECTIONS], const CPelBuf& srcLuma, const Area& blk, const int shift )
+{
+  const int blkSize = AdaptiveLoopFilter::m_CLASSIFICATION_BLK_SIZE;
+
+  if( blk.width != blkSize )
+  {
+    simdDeriveClassificationBlk<vext>( classifier, laplacian, srcLuma, blk, shift );
+    return;
+  }
+
+  const int stride = srcLuma.stride;
+  const int posX = blk.pos().x;
+  const int posY = blk.pos().y;
+
+  // column sums of the Laplacians of each pair of rows, the window of a 4x4 block starts 2 samples above and left of it
+  int16_t colSum[NUM_DIRECTIONS][( blkSize + 4 ) >> 1][blkSize + 32];
+
+  const int colSumWidth = blk.width + 4;
+
+  for( int i = 0; i < ( blk.height + 4 ) >> 1; i++ )
+  {
+    const Pel* src1 = srcLuma.buf + ( posY - 2 + 2 * i ) * stride + posX - 2;
+    const Pel* src0 = src1 - stride;
+    const Pel* src2 = src1 + stride;
+    const Pel* src3 = src2 + stride;
+
+    for( int x = 0; x < colSumWidth; x += 32 )
+    {
+      // the masked loads do not touch the samples right of the window
+      const __mmask32 mask = x + 32 <= colSumWidth ? 0xffffffff : ( __mmask32 ) ( ( 1u << ( colSumWidth - x ) ) - 1 );
+
+      const __m512i down   = _mm512_maskz_loadu_epi16( mask, src0 + x );
+      const __m512i downL  = _mm512_maskz_loadu_epi16( mask, src0 + x - 1 );
+      const __m512i downR  = _mm512_maskz_loadu_epi16( mask, src0 + x + 1 );
+      const __m512i cur    = _mm512_maskz_loadu_epi16( mask, src1 + x );
+      const __m512i curL   = _mm512_maskz_loadu_epi16( mask, src1 + x - 1 );
+      const __m512i curR   = _mm512_maskz_loadu_epi16( mask, src1 + x + 1 );
+      const __m512i up     = _mm512_maskz_loadu_epi16( mask, src2 + x );
+      const __m512i upL    = _mm512_maskz_loadu_epi16( mask, src2 + x - 1 );
+      const __m512i upR    = _mm512_maskz_loadu_epi16( mask, src2 + x + 1 );
+      const __m512i up2    = _mm512_maskz_loadu_epi16( mask, src3 + x );
+      const __m512i up2L   = _mm512_maskz_loadu_epi16( mask, src3 + x - 1 );
+      const __m512i up2R   = _mm512_maskz_loadu_epi16( mask, src3 + x + 1 );
+
+      const __m512i y0 = _mm512_slli_epi16( cur, 1 );
+      const __m512i y1 = _mm512_slli_epi16( up, 1 );
+
+      const __m512i ver = _mm512_add_epi16( _mm512_abs_epi16( _mm512_sub_epi16( y0, _mm512_add_epi16( down, up ) ) ),
+                                            _mm512_abs_epi16( _mm512_sub_epi16( y1, _mm512_add_epi16( cur, up2 ) ) ) );
+      const __m512i hor = _mm512_add_epi16( _mm512_abs_epi16( _mm512_sub_epi16( y0, _mm512_add_epi16( curL, curR ) ) ),
+                                            _mm512_abs_epi16( _mm512_sub_epi16( y1, _mm512_add_epi16( upL, upR ) ) ) );
+      const __m512i dig0 = _mm512_add_epi16( _mm512_abs_epi16( _mm512_sub_epi16( y0, _mm512_add_epi16( downL, upR ) ) ),
+                                             _mm512_abs_epi16( _mm512_sub_epi16( y1, _mm512_add_epi16( curL, up2R ) ) ) );
+      const __m512i dig1 = _mm512_add_epi16( _mm512_abs_epi16( _mm512_sub_epi16( y0, _mm512_add_epi16( upL, downR ) ) ),
+                                             _mm512_abs_epi16( _mm512_sub_epi16( y1, _mm512_add_epi16( up2L, curR ) ) ) );
+
+      _mm512_storeu_si512( ( void* ) &colSum[VER][i][x], ver );
+      _mm512_storeu_si512( ( void* ) &colSum[HOR][i][x], hor );
+      _mm512_storeu_si512( ( void* ) &colSum[DIAG0][i][x], dig0 );
+      _mm512_storeu_si512( ( void* ) &colSum[DIAG1][i][x], dig1 );
+    }
+  }
+
+  const __m512i vone  = _mm512_set1_epi16( 1 );
+  const __m256i vzero = _mm256_setzero_si256();
+  const __m256i vtwo  = _mm256_set1_epi32( 2 );
+  const __m256i vthree = _mm256_set1_epi32( 3 );
+  const __m256i vnine = _mm256_set1_epi32( 9 );
+  const __m256i vmaxActivity = _mm256_set1_epi32( 15 );
+  const __m256i vtransposeTable = _mm256_setr_epi32( 0, 1, 0, 2, 2, 3, 1, 3 );
+  const __m128i vactShift = _mm_cvtsi32_si128( shift - 5 );
+  // replicates the 16 bit classifier of a block to its 4 columns
+  const __m512i vrepeat = _mm512_set_epi64( 0x0908090809080908, 0x0100010001000100, 0x0908090809080908, 0x0100010001000100,
+                                            0x0908090809080908, 0x0100010001000100, 0x0908090809080908, 0x0100010001000100 );
+
+  for( int i = 0; i < blk.height; i += 4 )
+  {
+    // 8x8 window sums of the 8 blocks of the row, one block per 32 bit lane
+    __m256i vsum[NUM_DIRECTIONS];
+    for( int d = 0; d < NUM_DIRECTIONS; d++ )
+    {
+      __m512i va = _mm512_loadu_si512( ( const void* ) &colSum[d][i >> 1][0] );
+      __m512i vb = _mm512_loadu_si512( ( const void* ) &colSum[d][i >> 1][4] );
+      for( int k = 1; k < 4; k++ )
+      {
+        va = _mm512_add_epi16( va, _mm512_loadu_si512( ( const void* ) &colSum[d][( i >> 1 ) + k][0] ) );
+        vb = _mm512_add_epi16( vb, _mm512_loadu_si512( ( const void* ) &colSum[d][( i >> 1 ) + k][4] ) );
+      }
+      // pairs of columns 2m and 2m + 4, then the pairs of pairs give the sums of the columns 4j .. 4j + 7
+      __m512i vu = _mm512_add_epi32( _mm512_madd_epi16( va, vone ), _mm512_madd_epi16( vb, vone ) );
+      vu = _mm512_add_epi32( vu, _mm512_maskz_srli_epi64( 0xff, vu, 32 ) );
+      vsum[d] = _mm512_maskz_cvtepi64_epi32( 0xff, vu );
+    }
+
+    const __m256i sumV  = vsum[VER];
+    const __m256i sumH  = vsum[HOR];
+    const __m256i sumD0 = vsum[DIAG0];
+    const __m256i sumD1 = vsum[DIAG1];
+
+    const __m256i activity = _mm256_min_epi32( _mm256_sra_epi32( _mm256_add_epi32( sumV, sumH ), vactShift ), vmaxActivity );
+    // th[] = { 0, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4 }
+    __m256i classIdx = _mm256_add_epi32( _mm256_add_epi32( _mm256_cmpgt_epi32( activity, vzero ), _mm256_cmpgt_epi32( activity, _mm256_set1_epi32( 1 ) ) ),
+                                         _mm256_add_epi32( _mm256_cmpgt_epi32( activity, _mm256_set1_epi32( 6 ) ), _mm256_cmpgt_epi32( activity, _mm256_set1_epi32( 14 ) ) ) );
+    classIdx = _mm256_sub_epi32( vzero, classIdx );
+
+    const __m256i hv1 = _mm256_max_epi32( sumV, sumH );
+    const __m256i hv0 = _mm256_min_epi32( sumV, sumH );
+    const __m256i d1  = _mm256_max_epi32( sumD0, sumD1 );
+    const __m256i d0  = _mm256_min_epi32( sumD0, sumD1 );
+    const __m256i dirTempHV = _mm256_add_epi32( vthree, _mm256_slli_epi32( _mm256_cmpgt_epi32( sumV, sumH ), 1 ) );
+    const __m256i dirTempD  = _mm256_add_epi32( vtwo, _mm256_slli_epi32( _mm256_cmpgt_epi32( sumD0, sumD1 ), 1 ) );
+
+    const __m256i isD = _mm256_cmpgt_epi32( _mm256_mullo_epi32( d1, hv0 ), _mm256_mullo_epi32( hv1, d0 ) );
+    const __m256i hvd1 = _mm256_blendv_epi8( hv1, d1, isD );
+    const __m256i hvd0 = _mm256_blendv_epi8( hv0, d0, isD );
+    const __m256i mainDirection      = _mm256_blendv_epi8( dirTempHV, dirTempD, isD );
+    const __m256i secondaryDirection = _mm256_blendv_epi8( dirTempD, dirTempHV, isD );
+
+    const __m256i directionStrength = _mm256_sub_epi32( vzero, _mm256_add_epi32( _mm256_cmpgt_epi32( hvd1, _mm256_slli_epi32( hvd0, 1 ) ),
+                                                                                 _mm256_cmpgt_epi32( _mm256_slli_epi32( hvd1, 1 ), _mm256_mullo_epi32( vnine, hvd0 ) ) ) );
+    __m256i classOffset = _mm256_add_epi32( _mm256_slli_epi32( _mm256_and_si256( mainDirection, _mm256_set1_epi32( 1 ) ), 1 ), directionStrength );
+    classOffset = _mm256_add_epi32( classOffset, _mm256_slli_epi32( classOffset, 2 ) );
+    classIdx = _mm256_add_epi32( classIdx, _mm256_and_si256( classOffset, _mm256_cmpgt_epi32( directionStrength, vzero ) ) );
+
+    const __m256i transposeIdx = _mm256_permutevar8x32_epi32( vtransposeTable, _mm256_add_epi32( _mm256_slli_epi32( mainDirection, 1 ), _mm256_srli_epi32( secondaryDirection, 1 ) ) );
+
+    // AlfClassifier( classIdx, transposeIdx ) as 16 bit value
+    const __m256i vcls = _mm256_or_si256( classIdx, _mm256_slli_epi32( transposeIdx, 8 ) );
+    const __m512i vrow = _mm512_shuffle_epi8( _mm512_maskz_cvtepu32_epi64( 0xff, vcls ), vrepeat );
+
+    for( int k = 0; k < 4; k++ )
+    {
+      _mm512_storeu_si512( ( void* ) ( classifier[posY + i + k] + posX ), vrow );
+    }
+  }
+}
+
+template<X86_VEXT vext, AlfFilterType filtType>
+static void simdFilterBlk_AVX512( AlfClassifier** classifier, const PelUnitBuf &recDst, const CPelUnitBuf& recSrc, const Area& blk, const ComponentID compId, short* filterSet, const ClpRng& clpRng )
+{
+  const int width32 = blk.width & ~31;
+
+  if( width32 < blk.width )
+  {
+    const Area rest( blk.x + width32, blk.y, blk.width - width32, blk.height );
+    if( filtType == ALF_FILTER_5 )
+    {
+      simdFilter5x5Blk<vext>( classifier, recDst, recSrc, rest, compId, filterSet, clpRng );
+    }
+    else
+    {
+      simdFilter7x7Blk<vext>( classifier, recDst, recSrc, rest, compId, filterSet, clpRng );
+    }
+  }
+  if( width32 == 0 )
+  {
+    return;
+  }
+
+  // the first sample of each symmetric tap pair relative to the filtered sample, the center tap comes last
+  static const int tapPos7[12][2] = { { 3, 0 }, { 2, 1 }, { 2, 0 }, { 2, -1 }, { 1, 2 }, { 1, 1 }, { 1, 0 }, { 1, -1 }, { 1, -2 }, { 0, 3 }, { 0, 2 }, { 0, 1 } };
+  static const int tapPos5[6][2]  = { { 2, 0 }, { 1, 1 }, { 1, 0 }, { 1, -1 }, { 0, 2 }, { 0, 1 } };
+  static const int transpose7[4][13] = { { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 },
+                                         { 9, 4, 10, 8, 1, 5, 11, 7, 3, 0, 2, 6, 12 },
+                                         { 0, 3, 2, 1, 8, 7, 6, 5, 4, 9, 10, 11, 12 },
+                                         { 9, 8, 10, 4, 3, 7, 11, 5, 1, 0, 2, 6, 12 } };
+  static const int transpose5[4][7]  = { { 0, 1, 2, 3, 4, 5, 6 },
+                                         { 4, 1, 5, 3, 0, 2, 6 },
+                                         { 0, 3, 2, 1, 4, 5, 6 },
+                                         { 4, 3, 5, 1, 0, 2, 6 } };
+
+  const int numCoeff = filtType == ALF_FILTER_5 ? 7 : 13;
+  const int numPairs = ( numCoeff + 1 ) >> 1;
+  const int ( *tapPos )[2] = filtType == ALF_FILTER_5 ? tapPos5 : tapPos7;
+
+  const bool bChroma = isChroma( compId );
+
+  // the coefficients of two taps per 32 bit for _mm512_madd_epi16, for all classes and transpositions,
+  // the center tap is paired with zero
+  int32_t coeffPairs[MAX_NUM_ALF_CLASSES][4][7];
+  const int numClasses    = bChroma ? 1 : MAX_NUM_ALF_CLASSES;
+  const int numTransposes = bChroma ? 1 : 4;
+
+  for( int classIdx = 0; classIdx < numClasses; classIdx++ )
+  {
+    const short* coef = filterSet + classIdx * MAX_NUM_ALF_LUMA_COEFF;
+    for( int t = 0; t < numTransposes; t++ )
+    {
+      const int* transposeIdx = filtType == ALF_FILTER_5 ? transpose5[t] : transpose7[t];
+      for( int k = 0; k < numPairs; k++ )
+      {
+        const int c0 = coef[transposeIdx[2 * k]];
+        const int c1 = 2 * k + 1 < numCoeff ? coef[transposeIdx[2 * k + 1]] : 0;
+        coeffPairs[classIdx][t][k] = ( int32_t ) ( ( uint32_t ) ( c0 & 0xffff ) | ( ( uint32_t ) c1 << 16 ) );
+      }
+    }
+  }
+
+  const CPelBuf srcBuf = recSrc.get( compId );
+  PelBuf dstBuf = recDst.get( compId );
+
+  const int srcStride = srcBuf.stride;
+  const int dstStride = dstBuf.stride;
+
+  const Pel* src = srcBuf.buf + blk.y * srcStride + blk.x;
+  Pel* dst = dstBuf.buf + blk.y * dstStride + blk.x;
+
+  const int shift = AdaptiveLoopFilter::m_NUM_BITS - 1;
+
+  const __m512i voffset = _mm512_set1_epi32( 1 << ( shift - 1 ) );
+  const __m128i vshift  = _mm_cvtsi32_si128( shift );
+  const __m512i vmin    = _mm512_set1_epi16( clpRng.min );
+  const __m512i vmax    = _mm512_set1_epi16( clpRng.max );
+  const __m512i vzero   = _mm512_setzero_si512();
+
+  for( int i = 0; i < blk.height; i += 4 )
+  {
+    const AlfClassifier* pClass = bChroma ? nullptr : classifier[blk.y + i] + blk.x;
+
+    for( int j = 0; j < width32; j += 32 )
+    {
+      // the 128 bit lanes of the unpacked low and high halves hold the blocks 0, 2, 4, 6 and 1, 3, 5, 7
+      const int32_t* pairs[8];
+      for( int b = 0; b < 8; b++ )
+      {
+        pairs[b] = bChroma ? coeffPairs[0][0] : coeffPairs[pClass[j + 4 * b].classIdx][pClass[j + 4 * b].transposeIdx];
+      }
+
+      __m512i vcoeffLo[7], vcoeffHi[7];
+      for( int k = 0; k < numPairs; k++ )
+      {
+        vcoeffLo[k] = _mm512_set_epi32( pairs[6][k], pairs[6][k], pairs[6][k], pairs[6][k], pairs[4][k], pairs[4][k], pairs[4][k], pairs[4][k],
+                                        pairs[2][k], pairs[2][k], pairs[2][k], pairs[2][k], pairs[0][k], pairs[0][k], pairs[0][k], pairs[0][k] );
+        vcoeffHi[k] = _mm512_set_epi32( pairs[7][k], pairs[7][k], pairs[7][k], pairs[7][k], pairs[5][k], pairs[5][k], pairs[5][k], pairs[5][k],
+                                        pairs[3][k], pairs[3][k], pairs[3][k], pairs[3][k], pairs[1][k], pairs[1][k], pairs[1][k], pairs[1][k] );
+      }
+
+      for( int ii = 0; ii < 4; ii++ )
+      {
+        const Pel* pImg = src + ( i + ii ) * srcStride + j;
+
+        __m512i vsumLo = voffset;
+        __m512i vsumHi = voffset;
+
+        for( int k = 0; k < numPairs; k++ )
+        {
+          const int t0 = 2 * k;
+          const int t1 = 2 * k + 1;
+          const int off0 = tapPos[t0][0] * srcStride + tapPos[t0][1];
+
+          __m512i va, vb;
+          if( t1 < numCoeff )
+          {
+            const int off1 = tapPos[t1][0] * srcStride + tapPos[t1][1];
+            va = _mm512_add_epi16( _mm512_loadu_si512( ( const void* ) ( pImg + off0 ) ), _mm512_loadu_si512( ( const void* ) ( pImg - off0 ) ) );
+            vb = _mm512_add_epi16( _mm512_loadu_si512( ( const void* ) ( pImg + off1 ) ), _mm512_loadu_si512( ( const void* ) ( pImg - off1 ) ) );
+          }
+          else
+          {
+            va = _mm512_loadu_si512( ( const void* ) pImg );
+            vb = vzero;
+          }
+
+          vsumLo = _mm512_add_epi32( vsumLo, _mm512_madd_epi16( _mm512_unpacklo_epi16( va, vb ), vcoeffLo[k] ) );
+          vsumHi = _mm512_add_epi32( vsumHi, _mm512_madd_epi16( _mm512_unpackhi_epi16( va, vb ), vcoeffHi[k] ) );
+        }
+
+        vsumLo = _mm512_maskz_sra_epi32( 0xffff, vsumLo, vshift );
+        vsumHi = _mm512_maskz_sra_epi32( 0xffff, vsumHi, vshift );
+
+        __m512i vres = _mm512_packs_epi32( vsumLo, vsumHi );
+        vres = _mm512_min_epi16( vmax, _mm512_max_epi16( vmin, vres ) );
+
+        _mm512_storeu_si512( ( void* ) ( dst + ( i + ii ) * dstStride + j ), vres );
+      }
+    }
+  }
+}
+#endif
+
 template <X86_VEXT vext>
 void AdaptiveLoopFilter::_initAdaptiveLoopFilterX86()
 {
   m_deriveClassificationBlk = simdDeriveClassificationBlk<vext>;
   m_filter5x5Blk = simdFilter5x5Blk<vext>;
   m_filter7x7Blk = simdFilter7x7Blk<vext>;
+#ifdef USE_AVX512
+  if( vext >= AVX512 )
+  {
+    m_deriveClassificationBlk = simdDeriveClassificationBlk_AVX512<vext>;
+    m_filter5x5Blk = simdFilterBlk_AVX512<vext, ALF_FILTER_5>;
+    m_filter7x7Blk = simdFilterBlk_AVX512<vext, ALF_FILTER_7>;
+  }
+#endif
 }
 
 template void AdaptiveLoopFilter::_initAdaptiveLoopFilterX86<SIMDX86>();
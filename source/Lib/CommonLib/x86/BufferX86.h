@@ -211,6 +211,202 @@ void reco_SSE( const int16_t* src0, int src0Stride, const int16_t* src1, int src
   }
 }
 
+template< X86_VEXT vext, int W >
+void sub_SSE( const int16_t* src0, int src0Stride, const int16_t* src1, int src1Stride, int16_t *dst, int dstStride, int width, int height )
+{
+  if( W == 8 )
+  {
+    if( vext >= AVX2 && ( width & 15 ) == 0 )
+    {
+#if USE_AVX2
+      for( int row = 0; row < height; row++ )
+      {
+        for( int col = 0; col < width; col += 16 )
+        {
+          __m256i vsrc0 = _mm256_lddqu_si256( ( const __m256i * )&src0[col] );
+          __m256i vsrc1 = _mm256_lddqu_si256( ( const __m256i * )&src1[col] );
+
+          _mm256_storeu_si256( ( __m256i * )&dst[col], _mm256_sub_epi16( vsrc0, vsrc1 ) );
+        }
+
+        src0 += src0Stride;
+        src1 += src1Stride;
+        dst  += dstStride;
+      }
+#endif
+    }
+    else
+    {
+      for( int row = 0; row < height; row++ )
+      {
+        for( int col = 0; col < width; col += 8 )
+        {
+          __m128i vsrc0 = _mm_loadu_si128( ( const __m128i * )&src0[col] );
+          __m128i vsrc1 = _mm_loadu_si128( ( const __m128i * )&src1[col] );
+
+          _mm_storeu_si128( ( __m128i * )&dst[col], _mm_sub_epi16( vsrc0, vsrc1 ) );
+        }
+
+        src0 += src0Stride;
+        src1 += src1Stride;
+        dst  += dstStride;
+      }
+    }
+  }
+  else if( W == 4 )
+  {
+    for( int row = 0; row < height; row++ )
+    {
+      for( int col = 0; col < width; col += 4 )
+      {
+        __m128i vsrc0 = _mm_loadl_epi64( ( const __m128i * )&src0[col] );
+        __m128i vsrc1 = _mm_loadl_epi64( ( const __m128i * )&src1[col] );
+
+        _mm_storel_epi64( ( __m128i * )&dst[col], _mm_sub_epi16( vsrc0, vsrc1 ) );
+      }
+
+      src0 += src0Stride;
+      src1 += src1Stride;
+      dst  +=  dstStride;
+    }
+  }
+  else
+  {
+    THROW( "Unsupported size" );
+  }
+}
+
+template< X86_VEXT vext, int W >
+Distortion recoSSE_SSE( const int16_t* src0, int src0Stride, const int16_t* src1, int src1Stride, int16_t *dst, int dstStride, const int16_t* org, int orgStride, int width, int height, const ClpRng& clpRng )
+{
+  // the squared differences of one row are summed up in 32 bit and widened to 64 bit once per row
+  if( W == 8 )
+  {
+    if( vext >= AVX2 && ( width & 15 ) == 0 )
+    {
+#if USE_AVX2
+      __m256i vbdmin = _mm256_set1_epi16( clpRng.min );
+      __m256i vbdmax = _mm256_set1_epi16( clpRng.max );
+      __m256i vzero  = _mm256_setzero_si256();
+      __m256i vsum64 = _mm256_setzero_si256();
+
+      for( int row = 0; row < height; row++ )
+      {
+        __m256i vsum32 = _mm256_setzero_si256();
+
+        for( int col = 0; col < width; col += 16 )
+        {
+          __m256i vdest = _mm256_lddqu_si256( ( const __m256i * )&src0[col] );
+          __m256i vsrc1 = _mm256_lddqu_si256( ( const __m256i * )&src1[col] );
+          __m256i vorg  = _mm256_lddqu_si256( ( const __m256i * )&org [col] );
+
+          vdest = _mm256_add_epi16( vdest, vsrc1 );
+          vdest = _mm256_min_epi16( vbdmax, _mm256_max_epi16( vbdmin, vdest ) );
+
+          _mm256_storeu_si256( ( __m256i * )&dst[col], vdest );
+
+          __m256i vdiff = _mm256_sub_epi16( vorg, vdest );
+          vsum32 = _mm256_add_epi32( vsum32, _mm256_madd_epi16( vdiff, vdiff ) );
+        }
+
+        vsum64 = _mm256_add_epi64( vsum64, _mm256_unpacklo_epi32( vsum32, vzero ) );
+        vsum64 = _mm256_add_epi64( vsum64, _mm256_unpackhi_epi32( vsum32, vzero ) );
+
+        src0 += src0Stride;
+        src1 += src1Stride;
+        dst  += dstStride;
+        org  += orgStride;
+      }
+
+      __m128i vsum = _mm_add_epi64( _mm256_castsi256_si128( vsum64 ), _mm256_extracti128_si256( vsum64, 1 ) );
+      vsum = _mm_add_epi64( vsum, _mm_unpackhi_epi64( vsum, vsum ) );
+      return ( Distortion ) _mm_cvtsi128_si64( vsum );
+#endif
+    }
+    else
+    {
+      __m128i vbdmin = _mm_set1_epi16( clpRng.min );
+      __m128i vbdmax = _mm_set1_epi16( clpRng.max );
+      __m128i vzero  = _mm_setzero_si128();
+      __m128i vsum64 = _mm_setzero_si128();
+
+      for( int row = 0; row < height; row++ )
+      {
+        __m128i vsum32 = _mm_setzero_si128();
+
+        for( int col = 0; col < width; col += 8 )
+        {
+          __m128i vdest = _mm_loadu_si128( ( const __m128i * )&src0[col] );
+          __m128i vsrc1 = _mm_loadu_si128( ( const __m128i * )&src1[col] );
+          __m128i vorg  = _mm_loadu_si128( ( const __m128i * )&org [col] );
+
+          vdest = _mm_add_epi16( vdest, vsrc1 );
+          vdest = _mm_min_epi16( vbdmax, _mm_max_epi16( vbdmin, vdest ) );
+
+          _mm_storeu_si128( ( __m128i * )&dst[col], vdest );
+
+          __m128i vdiff = _mm_sub_epi16( vorg, vdest );
+          vsum32 = _mm_add_epi32( vsum32, _mm_madd_epi16( vdiff, vdiff ) );
+        }
+
+        vsum64 = _mm_add_epi64( vsum64, _mm_unpacklo_epi32( vsum32, vzero ) );
+        vsum64 = _mm_add_epi64( vsum64, _mm_unpackhi_epi32( vsum32, vzero ) );
+
+        src0 += src0Stride;
+        src1 += src1Stride;
+        dst  += dstStride;
+        org  += orgStride;
+      }
+
+      vsum64 = _mm_add_epi64( vsum64, _mm_unpackhi_epi64( vsum64, vsum64 ) );
+      return ( Distortion ) _mm_cvtsi128_si64( vsum64 );
+    }
+  }
+  else if( W == 4 )
+  {
+    __m128i vbdmin = _mm_set1_epi16( clpRng.min );
+    __m128i vbdmax = _mm_set1_epi16( clpRng.max );
+    __m128i vzero  = _mm_setzero_si128();
+    __m128i vsum64 = _mm_setzero_si128();
+
+    for( int row = 0; row < height; row++ )
+    {
+      __m128i vsum32 = _mm_setzero_si128();
+
+      for( int col = 0; col < width; col += 4 )
+      {
+        __m128i vsrc = _mm_loadl_epi64( ( const __m128i * )&src0[col] );
+        __m128i vdst = _mm_loadl_epi64( ( const __m128i * )&src1[col] );
+        __m128i vorg = _mm_loadl_epi64( ( const __m128i * )&org [col] );
+
+        vdst = _mm_add_epi16( vdst, vsrc );
+        vdst = _mm_min_epi16( vbdmax, _mm_max_epi16( vbdmin, vdst ) );
+
+        _mm_storel_epi64( ( __m128i * )&dst[col], vdst );
+
+        // only the lower four samples are valid
+        __m128i vdiff = _mm_move_epi64( _mm_sub_epi16( vorg, vdst ) );
+        vsum32 = _mm_add_epi32( vsum32, _mm_madd_epi16( vdiff, vdiff ) );
+      }
+
+      vsum64 = _mm_add_epi64( vsum64, _mm_unpacklo_epi32( vsum32, vzero ) );
+
+      src0 += src0Stride;
+      src1 += src1Stride;
+      dst  +=  dstStride;
+      org  +=  orgStride;
+    }
+
+    vsum64 = _mm_add_epi64( vsum64, _mm_unpackhi_epi64( vsum64, vsum64 ) );
+    return ( Distortion ) _mm_cvtsi128_si64( vsum64 );
+  }
+  else
+  {
+    THROW( "Unsupported size" );
+  }
+  return 0;
+}
+
 template<bool doShift, bool shiftR, typename T> static inline void do_shift( T &vreg, int num );
 #if USE_AVX2
 template<> inline void do_shift<true,  true , __m256i>( __m256i &vreg, int num ) { vreg = _mm256_srai_epi32( vreg, num ); }
@@ -362,6 +558,226 @@ void linTf_SSE_entry( const Pel* src, int srcStride, Pel *dst, int dstStride, in
   }
 }
 
+template< X86_VEXT vext, int W >
+void wghtAvg_SSE( const int16_t* src0, int src0Stride, const int16_t* src1, int src1Stride, int16_t *dst, int dstStride, int width, int height, int w0, int w1, int shift, int offset, const ClpRng& clpRng )
+{
+  // the weights are interleaved to match the interleaved samples of both sources, so that
+  // w0 * src0 + w1 * src1 is computed by a single multiply-add per 32 bit lane
+  if( W == 8 )
+  {
+    if( vext >= AVX2 && ( width & 15 ) == 0 )
+    {
+#if USE_AVX2
+      __m256i vw      = _mm256_set1_epi32( ( w1 << 16 ) | ( w0 & 0xffff ) );
+      __m256i voffset = _mm256_set1_epi32( offset );
+      __m128i vshift  = _mm_cvtsi32_si128( shift );
+      __m256i vbdmin  = _mm256_set1_epi16( clpRng.min );
+      __m256i vbdmax  = _mm256_set1_epi16( clpRng.max );
+
+      for( int row = 0; row < height; row++ )
+      {
+        for( int col = 0; col < width; col += 16 )
+        {
+          __m256i vsrc0 = _mm256_lddqu_si256( ( const __m256i * )&src0[col] );
+          __m256i vsrc1 = _mm256_lddqu_si256( ( const __m256i * )&src1[col] );
+
+          __m256i vsumlo = _mm256_madd_epi16( _mm256_unpacklo_epi16( vsrc0, vsrc1 ), vw );
+          __m256i vsumhi = _mm256_madd_epi16( _mm256_unpackhi_epi16( vsrc0, vsrc1 ), vw );
+
+          vsumlo = _mm256_sra_epi32( _mm256_add_epi32( vsumlo, voffset ), vshift );
+          vsumhi = _mm256_sra_epi32( _mm256_add_epi32( vsumhi, voffset ), vshift );
+
+          __m256i vdst = _mm256_packs_epi32( vsumlo, vsumhi );
+          vdst = _mm256_min_epi16( vbdmax, _mm256_max_epi16( vbdmin, vdst ) );
+
+          _mm256_storeu_si256( ( __m256i * )&dst[col], vdst );
+        }
+
+        src0 += src0Stride;
+        src1 += src1Stride;
+        dst  +=  dstStride;
+      }
+#endif
+    }
+    else
+    {
+      __m128i vw      = _mm_set1_epi32( ( w1 << 16 ) | ( w0 & 0xffff ) );
+      __m128i voffset = _mm_set1_epi32( offset );
+      __m128i vshift  = _mm_cvtsi32_si128( shift );
+      __m128i vbdmin  = _mm_set1_epi16( clpRng.min );
+      __m128i vbdmax  = _mm_set1_epi16( clpRng.max );
+
+      for( int row = 0; row < height; row++ )
+      {
+        for( int col = 0; col < width; col += 8 )
+        {
+          __m128i vsrc0 = _mm_loadu_si128( ( const __m128i * )&src0[col] );
+          __m128i vsrc1 = _mm_loadu_si128( ( const __m128i * )&src1[col] );
+
+          __m128i vsumlo = _mm_madd_epi16( _mm_unpacklo_epi16( vsrc0, vsrc1 ), vw );
+          __m128i vsumhi = _mm_madd_epi16( _mm_unpackhi_epi16( vsrc0, vsrc1 ), vw );
+
+          vsumlo = _mm_sra_epi32( _mm_add_epi32( vsumlo, voffset ), vshift );
+          vsumhi = _mm_sra_epi32( _mm_add_epi32( vsumhi, voffset ), vshift );
+
+          __m128i vdst = _mm_packs_epi32( vsumlo, vsumhi );
+          vdst = _mm_min_epi16( vbdmax, _mm_max_epi16( vbdmin, vdst ) );
+
+          _mm_storeu_si128( ( __m128i * )&dst[col], vdst );
+        }
+
+        src0 += src0Stride;
+        src1 += src1Stride;
+        dst  +=  dstStride;
+      }
+    }
+  }
+  else if( W == 4 )
+  {
+    __m128i vzero   = _mm_setzero_si128();
+    __m128i vw      = _mm_set1_epi32( ( w1 << 16 ) | ( w0 & 0xffff ) );
+    __m128i voffset = _mm_set1_epi32( offset );
+    __m128i vshift  = _mm_cvtsi32_si128( shift );
+    __m128i vbdmin  = _mm_set1_epi16( clpRng.min );
+    __m128i vbdmax  = _mm_set1_epi16( clpRng.max );
+
+    for( int row = 0; row < height; row++ )
+    {
+      for( int col = 0; col < width; col += 4 )
+      {
+        __m128i vsrc0 = _mm_loadl_epi64( ( const __m128i * )&src0[col] );
+        __m128i vsrc1 = _mm_loadl_epi64( ( const __m128i * )&src1[col] );
+
+        __m128i vsum = _mm_madd_epi16( _mm_unpacklo_epi16( vsrc0, vsrc1 ), vw );
+        vsum = _mm_sra_epi32( _mm_add_epi32( vsum, voffset ), vshift );
+
+        __m128i vdst = _mm_packs_epi32( vsum, vzero );
+        vdst = _mm_min_epi16( vbdmax, _mm_max_epi16( vbdmin, vdst ) );
+
+        _mm_storel_epi64( ( __m128i * )&dst[col], vdst );
+      }
+
+      src0 += src0Stride;
+      src1 += src1Stride;
+      dst  +=  dstStride;
+    }
+  }
+  else
+  {
+    THROW( "Unsupported size" );
+  }
+}
+
+template< X86_VEXT vext, int W >
+void wghtUni_SSE( const int16_t* src0, int src0Stride, int16_t *dst, int dstStride, int width, int height, int w0, int shift, int round, int offset, const ClpRng& clpRng )
+{
+  // the 32 bit products w0 * src0 are assembled from the low and high halves of the 16 bit multiplication
+  if( W == 8 )
+  {
+    if( vext >= AVX2 && ( width & 15 ) == 0 )
+    {
+#if USE_AVX2
+      __m256i vw      = _mm256_set1_epi16( w0 );
+      __m256i vround  = _mm256_set1_epi32( round );
+      __m256i voffset = _mm256_set1_epi32( offset );
+      __m128i vshift  = _mm_cvtsi32_si128( shift );
+      __m256i vbdmin  = _mm256_set1_epi16( clpRng.min );
+      __m256i vbdmax  = _mm256_set1_epi16( clpRng.max );
+
+      for( int row = 0; row < height; row++ )
+      {
+        for( int col = 0; col < width; col += 16 )
+        {
+          __m256i vsrc  = _mm256_lddqu_si256( ( const __m256i * )&src0[col] );
+          __m256i vmlo  = _mm256_mullo_epi16( vsrc, vw );
+          __m256i vmhi  = _mm256_mulhi_epi16( vsrc, vw );
+
+          __m256i vsumlo = _mm256_unpacklo_epi16( vmlo, vmhi );
+          __m256i vsumhi = _mm256_unpackhi_epi16( vmlo, vmhi );
+
+          vsumlo = _mm256_add_epi32( _mm256_sra_epi32( _mm256_add_epi32( vsumlo, vround ), vshift ), voffset );
+          vsumhi = _mm256_add_epi32( _mm256_sra_epi32( _mm256_add_epi32( vsumhi, vround ), vshift ), voffset );
+
+          __m256i vdst = _mm256_packs_epi32( vsumlo, vsumhi );
+          vdst = _mm256_min_epi16( vbdmax, _mm256_max_epi16( vbdmin, vdst ) );
+
+          _mm256_storeu_si256( ( __m256i * )&dst[col], vdst );
+        }
+
+        src0 += src0Stride;
+        dst  +=  dstStride;
+      }
+#endif
+    }
+    else
+    {
+      __m128i vw      = _mm_set1_epi16( w0 );
+      __m128i vround  = _mm_set1_epi32( round );
+      __m128i voffset = _mm_set1_epi32( offset );
+      __m128i vshift  = _mm_cvtsi32_si128( shift );
+      __m128i vbdmin  = _mm_set1_epi16( clpRng.min );
+      __m128i vbdmax  = _mm_set1_epi16( clpRng.max );
+
+      for( int row = 0; row < height; row++ )
+      {
+        for( int col = 0; col < width; col += 8 )
+        {
+          __m128i vsrc  = _mm_loadu_si128( ( const __m128i * )&src0[col] );
+          __m128i vmlo  = _mm_mullo_epi16( vsrc, vw );
+          __m128i vmhi  = _mm_mulhi_epi16( vsrc, vw );
+
+          __m128i vsumlo = _mm_unpacklo_epi16( vmlo, vmhi );
+          __m128i vsumhi = _mm_unpackhi_epi16( vmlo, vmhi );
+
+          vsumlo = _mm_add_epi32( _mm_sra_epi32( _mm_add_epi32( vsumlo, vround ), vshift ), voffset );
+          vsumhi = _mm_add_epi32( _mm_sra_epi32( _mm_add_epi32( vsumhi, vround ), vshift ), voffset );
+
+          __m128i vdst = _mm_packs_epi32( vsumlo, vsumhi );
+          vdst = _mm_min_epi16( vbdmax, _mm_max_epi16( vbdmin, vdst ) );
+
+          _mm_storeu_si128( ( __m128i * )&dst[col], vdst );
+        }
+
+        src0 += src0Stride;
+        dst  +=  dstStride;
+      }
+    }
+  }
+  else if( W == 4 )
+  {
+    __m128i vzero   = _mm_setzero_si128();
+    __m128i vw      = _mm_set1_epi16( w0 );
+    __m128i vround  = _mm_set1_epi32( round );
+    __m128i voffset = _mm_set1_epi32( offset );
+    __m128i vshift  = _mm_cvtsi32_si128( shift );
+    __m128i vbdmin  = _mm_set1_epi16( clpRng.min );
+    __m128i vbdmax  = _mm_set1_epi16( clpRng.max );
+
+    for( int row = 0; row < height; row++ )
+    {
+      for( int col = 0; col < width; col += 4 )
+      {
+        __m128i vsrc = _mm_loadl_epi64( ( const __m128i * )&src0[col] );
+        __m128i vsum = _mm_unpacklo_epi16( _mm_mullo_epi16( vsrc, vw ), _mm_mulhi_epi16( vsrc, vw ) );
+
+        vsum = _mm_add_epi32( _mm_sra_epi32( _mm_add_epi32( vsum, vround ), vshift ), voffset );
+
+        __m128i vdst = _mm_packs_epi32( vsum, vzero );
+        vdst = _mm_min_epi16( vbdmax, _mm_max_epi16( vbdmin, vdst ) );
+
+        _mm_storel_epi64( ( __m128i * )&dst[col], vdst );
+      }
+
+      src0 += src0Stride;
+      dst  +=  dstStride;
+    }
+  }
+  else
+  {
+    THROW( "Unsupported size" );
+  }
+}
+
 template<X86_VEXT vext>
 void PelBufferOps::_initPelBufOpsX86()
 {
@@ -371,8 +787,20 @@ void PelBufferOps::_initPelBufOpsX86()
   reco8 = reco_SSE<vext, 8>;
   reco4 = reco_SSE<vext, 4>;
 
+  sub8 = sub_SSE<vext, 8>;
+  sub4 = sub_SSE<vext, 4>;
+
+  recoSSE8 = recoSSE_SSE<vext, 8>;
+  recoSSE4 = recoSSE_SSE<vext, 4>;
+
   linTf8 = linTf_SSE_entry<vext, 8>;
   linTf4 = linTf_SSE_entry<vext, 4>;
+
+  wghtAvg8 = wghtAvg_SSE<vext, 8>;
+  wghtAvg4 = wghtAvg_SSE<vext, 4>;
+
+  wghtUni8 = wghtUni_SSE<vext, 8>;
+  wghtUni4 = wghtUni_SSE<vext, 4>;
 }
 
 template void PelBufferOps::_initPelBufOpsX86<SIMDX86>();
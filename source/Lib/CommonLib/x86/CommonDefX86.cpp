@@ -122,6 +122,7 @@ static inline int64_t xgetbv (int ctr) {
 #define BIT_HAS_AVX512F                (1 << 16)
 #define BIT_HAS_AVX512DQ               (1 << 17)
 #define BIT_HAS_AVX512BW               (1 << 30)
+#define BIT_HAS_AVX512VL               (1u << 31)
 #define BIT_HAS_FMA3                   (1 << 12)
 #define BIT_HAS_FMA4                   (1 << 16)
 #define BIT_HAS_X64                    (1 << 29)
@@ -155,14 +156,13 @@ X86_VEXT _get_x86_extensions()
     if (!(regs[1] & BIT_HAS_AVX2))  return ext;
     ext = AVX2;
 // #endif
-#ifdef USE_AVX512
     if ((xgetbv(0) & 0xE0) != 0xE0) return ext; // see if OPMASK state and ZMM are availabe and enabled
     do_cpuidex( regs, 7, 0 );
     if (!(regs[1] & BIT_HAS_AVX512F ))  return ext;
     if (!(regs[1] & BIT_HAS_AVX512DQ))  return ext;
     if (!(regs[1] & BIT_HAS_AVX512BW))  return ext;
+    if (!(regs[1] & BIT_HAS_AVX512VL))  return ext;
     ext = AVX512;
-#endif
 #endif
 
     return ext;
@@ -43,10 +43,23 @@
 //! \ingroup CommonLib
 //! \{
 
+#if defined __GNUC__ && !defined __clang__ && __GNUC__ == 12
+// the AVX-512 intrinsics of gcc 12 pass self-initialized undefined vectors, which -Wall reports (gcc bug 105593)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
 #include <immintrin.h>
+#pragma GCC diagnostic pop
+#else
+#include <immintrin.h>
+#endif
 
 #ifdef USE_AVX512
 #define SIMDX86 AVX512
+// the AVX-512 tier builds on top of the AVX2 code paths
+#ifndef USE_AVX2
+#define USE_AVX2 1
+#endif
 #elif defined USE_AVX2
 #define SIMDX86 AVX2
 #elif defined USE_AVX
@@ -303,7 +316,8 @@ static inline void TRANSPOSE8x8_32b_AVX2(__m256i T[8])
 
 #endif
 
-#ifdef USE_AVX512
+// older GCC versions do not provide _mm512_set_epi16
+#if defined( USE_AVX512 ) && defined( __GNUC__ ) && !defined( __clang__ ) && ( __GNUC__ < 9 )
 
 ALWAYS_INLINE inline __m512i
 _mm512_set_epi16( int16_t x31, int16_t x30, int16_t x29, int16_t x28,
@@ -41,6 +41,8 @@
 #include "CommonLib/CommonDef.h"
 #include "CommonLib/InterpolationFilter.h"
 #include "CommonLib/TrQuant.h"
+#include "CommonLib/QuantRDOQ.h"
+#include "CommonLib/IntraPrediction.h"
 #include "CommonLib/RdCost.h"
 #include "CommonLib/Buffer.h"
 
@@ -57,6 +59,8 @@ void InterpolationFilter::initInterpolationFilterX86( /*int iBitDepthY, int iBit
   auto vext = read_x86_extension_flags();
   switch (vext){
   case AVX512:
+    _initInterpolationFilterX86<AVX512>(/*iBitDepthY, iBitDepthC*/);
+    break;
   case AVX2:
     _initInterpolationFilterX86<AVX2>(/*iBitDepthY, iBitDepthC*/);
     break;
@@ -104,6 +108,8 @@ void RdCost::initRdCostX86()
   auto vext = read_x86_extension_flags();
   switch (vext){
     case AVX512:
+      _initRdCostX86<AVX512>();
+      break;
     case AVX2:
       _initRdCostX86<AVX2>();
       break;
@@ -149,6 +155,8 @@ void AdaptiveLoopFilter::initAdaptiveLoopFilterX86()
   switch ( vext )
   {
   case AVX512:
+    _initAdaptiveLoopFilterX86<AVX512>();
+    break;
   case AVX2:
     _initAdaptiveLoopFilterX86<AVX2>();
     break;
@@ -165,6 +173,52 @@ void AdaptiveLoopFilter::initAdaptiveLoopFilterX86()
 }
 #endif
 
+#if ENABLE_SIMD_OPT_QUANT
+void QuantRDOQ::initQuantRDOQX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch ( vext )
+  {
+  case AVX512:
+  case AVX2:
+    _initQuantRDOQX86<AVX2>();
+    break;
+  case AVX:
+    _initQuantRDOQX86<AVX>();
+    break;
+  case SSE42:
+  case SSE41:
+    _initQuantRDOQX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
+#endif
+
+#if ENABLE_SIMD_OPT_INTRA
+void IntraPrediction::initIntraPredictionX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch ( vext )
+  {
+  case AVX512:
+  case AVX2:
+    _initIntraPredictionX86<AVX2>();
+    break;
+  case AVX:
+    _initIntraPredictionX86<AVX>();
+    break;
+  case SSE42:
+  case SSE41:
+    _initIntraPredictionX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
+#endif
+
 #if ENABLE_SIMD_OPT_CPR
 void IbcHashMap::initIbcHashMapX86()
 {
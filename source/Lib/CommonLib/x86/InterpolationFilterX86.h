@@ -847,6 +847,138 @@ static void simdInterpolateVerM16_AVX2( const int16_t *src, int srcStride, int16
 }
 
 
+template<X86_VEXT vext, int N, bool shiftBack>
+static void simdInterpolateHorM32_AVX512( const int16_t* src, int srcStride, int16_t *dst, int dstStride, int width, int height, int shift, int offset, const ClpRng& clpRng, int16_t const *coeff )
+{
+#ifdef USE_AVX512
+  // same lane layout as simdInterpolateHorM16_AVX2, each 128 bit lane produces 8 consecutive output samples
+  __m512i voffset    = _mm512_set1_epi32( offset );
+  __m512i vibdimin   = _mm512_set1_epi16( clpRng.min );
+  __m512i vibdimax   = _mm512_set1_epi16( clpRng.max );
+  __m512i vzero      = _mm512_setzero_si512();
+  __m512i vsum, vsuma, vsumb;
+
+  __m512i vshuf0 = _mm512_broadcast_i32x4( _mm_set_epi8( 0x9, 0x8, 0x7, 0x6, 0x7, 0x6, 0x5, 0x4, 0x5, 0x4, 0x3, 0x2, 0x3, 0x2, 0x1, 0x0 ) );
+  __m512i vshuf1 = _mm512_broadcast_i32x4( _mm_set_epi8( 0xd, 0xc, 0xb, 0xa, 0xb, 0xa, 0x9, 0x8, 0x9, 0x8, 0x7, 0x6, 0x7, 0x6, 0x5, 0x4 ) );
+  __m512i vcoeff[N/2];
+  for( int i=0; i<N; i+=2 )
+  {
+    vcoeff[i/2] = _mm512_unpacklo_epi16( _mm512_set1_epi16( coeff[i] ), _mm512_set1_epi16( coeff[i+1] ) );
+  }
+
+  for( int row = 0; row < height; row++ )
+  {
+    _mm_prefetch( (const char*)( src+2*srcStride ), _MM_HINT_T0 );
+    _mm_prefetch( (const char*)( src+( width>>1 )+2*srcStride ), _MM_HINT_T0 );
+    _mm_prefetch( (const char*)( src+width+N-1 + 2*srcStride ), _MM_HINT_T0 );
+
+    for( int col = 0; col < width; col+=32 )
+    {
+      __m512i vsrc[3];
+      for( int i=0; i<3; i++ )
+      {
+        vsrc[i] = _mm512_loadu_si512( ( const void * )&src[col+i*4] );
+      }
+      if( N==8 )
+      {
+        vsuma = vsumb = vzero;
+        for( int i=0; i<2; i++ )
+        {
+          __m512i vsrca0 = _mm512_shuffle_epi8( vsrc[i], vshuf0 );
+          __m512i vsrca1 = _mm512_shuffle_epi8( vsrc[i], vshuf1 );
+          __m512i vsrcb0 = _mm512_shuffle_epi8( vsrc[i+1], vshuf0 );
+          __m512i vsrcb1 = _mm512_shuffle_epi8( vsrc[i+1], vshuf1 );
+          vsuma  = _mm512_add_epi32( vsuma, _mm512_add_epi32( _mm512_madd_epi16( vsrca0, vcoeff[2*i] ), _mm512_madd_epi16( vsrca1, vcoeff[2*i+1] ) ) );
+          vsumb  = _mm512_add_epi32( vsumb, _mm512_add_epi32( _mm512_madd_epi16( vsrcb0, vcoeff[2*i] ), _mm512_madd_epi16( vsrcb1, vcoeff[2*i+1] ) ) );
+        }
+      }
+      else
+      {
+        vsuma = _mm512_add_epi32( _mm512_madd_epi16( _mm512_shuffle_epi8( vsrc[0], vshuf0 ), vcoeff[0] ), _mm512_madd_epi16( _mm512_shuffle_epi8( vsrc[0], vshuf1 ), vcoeff[1] ) );
+        vsumb = _mm512_add_epi32( _mm512_madd_epi16( _mm512_shuffle_epi8( vsrc[1], vshuf0 ), vcoeff[0] ), _mm512_madd_epi16( _mm512_shuffle_epi8( vsrc[1], vshuf1 ), vcoeff[1] ) );
+      }
+
+      vsuma = _mm512_srai_epi32( _mm512_add_epi32( vsuma, voffset ), shift );
+      vsumb = _mm512_srai_epi32( _mm512_add_epi32( vsumb, voffset ), shift );
+      vsum  = _mm512_packs_epi32( vsuma, vsumb );
+
+      if( shiftBack )
+      { //clip
+        vsum = _mm512_min_epi16( vibdimax, _mm512_max_epi16( vibdimin, vsum ) );
+      }
+
+      _mm512_storeu_si512( ( void * )&dst[col], vsum );
+    }
+    src += srcStride;
+    dst += dstStride;
+  }
+#endif
+}
+
+
+template<X86_VEXT vext, int N, bool shiftBack>
+static void simdInterpolateVerM32_AVX512( const int16_t *src, int srcStride, int16_t *dst, int dstStride, int width, int height, int shift, int offset, const ClpRng& clpRng, int16_t const *coeff )
+{
+#ifdef USE_AVX512
+  __m512i voffset    = _mm512_set1_epi32( offset );
+  __m512i vibdimin   = _mm512_set1_epi16( clpRng.min );
+  __m512i vibdimax   = _mm512_set1_epi16( clpRng.max );
+  __m512i vzero      = _mm512_setzero_si512();
+  __m512i vsum, vsuma, vsumb;
+
+  __m512i vsrc[N];
+  __m512i vcoeff[N/2];
+  for( int i=0; i<N; i+=2 )
+  {
+    vcoeff[i/2] = _mm512_unpacklo_epi16( _mm512_set1_epi16( coeff[i] ), _mm512_set1_epi16( coeff[i+1] ) );
+  }
+
+  const short *srcOrig = src;
+  int16_t *dstOrig = dst;
+
+  for( int col = 0; col < width; col+=32 )
+  {
+    for( int i=0; i<N-1; i++ )
+    {
+      vsrc[i] = _mm512_loadu_si512( ( const void * )&src[col + i * srcStride] );
+    }
+    for( int row = 0; row < height; row++ )
+    {
+      vsrc[N-1]= _mm512_loadu_si512( ( const void * )&src[col + ( N-1 ) * srcStride] );
+      vsuma = vsumb = vzero;
+      for( int i=0; i<N; i+=2 )
+      {
+        __m512i vsrca = _mm512_unpacklo_epi16( vsrc[i], vsrc[i+1] );
+        __m512i vsrcb = _mm512_unpackhi_epi16( vsrc[i], vsrc[i+1] );
+        vsuma  = _mm512_add_epi32( vsuma, _mm512_madd_epi16( vsrca, vcoeff[i/2] ) );
+        vsumb  = _mm512_add_epi32( vsumb, _mm512_madd_epi16( vsrcb, vcoeff[i/2] ) );
+      }
+      for( int i=0; i<N-1; i++ )
+      {
+        vsrc[i] = vsrc[i+1];
+      }
+
+      vsuma = _mm512_srai_epi32( _mm512_add_epi32( vsuma, voffset ), shift );
+      vsumb = _mm512_srai_epi32( _mm512_add_epi32( vsumb, voffset ), shift );
+      vsum  = _mm512_packs_epi32( vsuma, vsumb );
+
+      if( shiftBack )
+      { //clip
+        vsum = _mm512_min_epi16( vibdimax, _mm512_max_epi16( vibdimin, vsum ) );
+      }
+
+      _mm512_storeu_si512( ( void * )&dst[col], vsum );
+
+      src += srcStride;
+      dst += dstStride;
+    }
+    src= srcOrig;
+    dst= dstOrig;
+  }
+#endif
+}
+
+
 template<int N, bool isLast>
 inline void interpolate( const int16_t* src, int cStride, int16_t *dst, int width, int shift, int offset, int bitdepth, int maxVal, int16_t const *c )
 {
@@ -1029,7 +1161,19 @@ static void simdFilter( const ClpRng& clpRng, Pel const *src, int srcStride, Pel
 
   if( clpRng.bd <= 10 )
   {
-    if( N == 8 && !( width & 0x07 ) )
+    if( vext >= AVX512 && ( N == 8 || N == 4 ) && !( width & 0x1f ) )
+    {
+      if( !isVertical )
+      {
+        simdInterpolateHorM32_AVX512<vext, N, isLast>( src, srcStride, dst, dstStride, width, height, shift, offset, clpRng, c );
+      }
+      else
+      {
+        simdInterpolateVerM32_AVX512<vext, N, isLast>( src, srcStride, dst, dstStride, width, height, shift, offset, clpRng, c );
+      }
+      return;
+    }
+    else if( N == 8 && !( width & 0x07 ) )
     {
       if( !isVertical )
       {
@@ -1124,6 +1268,100 @@ static void simdFilter( const ClpRng& clpRng, Pel const *src, int srcStride, Pel
   }
 }
 
+// SIMD 8-tap 2-D interpolation of a 4x4 block, the horizontally filtered rows are kept in registers
+template<X86_VEXT vext, bool isLast>
+static void simdFilter4x4_N8( const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, TFilterCoeff const *coeffH, TFilterCoeff const *coeffV )
+{
+  if( clpRng.bd > 10 )
+  {
+    InterpolationFilter::filter4x4<isLast>( clpRng, src, srcStride, dst, dstStride, coeffH, coeffV );
+    return;
+  }
+
+  const int headRoom = std::max<int>( 2, ( IF_INTERNAL_PREC - clpRng.bd ) );
+  const int shiftH   = IF_FILTER_PREC - headRoom;
+  const int offsetH  = -IF_INTERNAL_OFFS << shiftH;
+  const int shiftV   = isLast ? IF_FILTER_PREC + headRoom : IF_FILTER_PREC;
+  const int offsetV  = isLast ? ( 1 << ( shiftV - 1 ) ) + ( IF_INTERNAL_OFFS << IF_FILTER_PREC ) : 0;
+
+  src -= ( NTAPS_LUMA / 2 - 1 ) * srcStride + ( NTAPS_LUMA / 2 - 1 );
+
+  __m128i vrow[4 + NTAPS_LUMA - 1];
+  __m128i vcoeffh = _mm_loadu_si128( ( __m128i const * )coeffH );
+  __m128i voffh   = _mm_set1_epi32( offsetH );
+  int row = 0;
+
+#if USE_AVX2
+  if( vext >= AVX2 )
+  {
+    // two rows per iteration, one in each 128 bit lane
+    __m256i vcoeffh2 = _mm256_broadcastsi128_si256( vcoeffh );
+    __m256i voffh2   = _mm256_set1_epi32( offsetH );
+
+    for( ; row + 1 < 4 + NTAPS_LUMA - 1; row += 2 )
+    {
+      __m256i vsum[4];
+      for( int i = 0; i < 4; i++ )
+      {
+        __m256i vsrc = _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( ( __m128i const * )&src[i] ) ), _mm_loadu_si128( ( __m128i const * )&src[i + srcStride] ), 1 );
+        vsum[i] = _mm256_madd_epi16( vsrc, vcoeffh2 );
+      }
+      __m256i vres = _mm256_hadd_epi32( _mm256_hadd_epi32( vsum[0], vsum[1] ), _mm256_hadd_epi32( vsum[2], vsum[3] ) );
+      vres = _mm256_srai_epi32( _mm256_add_epi32( vres, voffh2 ), shiftH );
+      vres = _mm256_packs_epi32( vres, vres );
+
+      vrow[row]     = _mm256_castsi256_si128( vres );
+      vrow[row + 1] = _mm256_extracti128_si256( vres, 1 );
+
+      src += 2 * srcStride;
+    }
+  }
+#endif
+
+  for( ; row < 4 + NTAPS_LUMA - 1; row++ )
+  {
+    __m128i vsum0 = _mm_madd_epi16( _mm_loadu_si128( ( __m128i const * )&src[0] ), vcoeffh );
+    __m128i vsum1 = _mm_madd_epi16( _mm_loadu_si128( ( __m128i const * )&src[1] ), vcoeffh );
+    __m128i vsum2 = _mm_madd_epi16( _mm_loadu_si128( ( __m128i const * )&src[2] ), vcoeffh );
+    __m128i vsum3 = _mm_madd_epi16( _mm_loadu_si128( ( __m128i const * )&src[3] ), vcoeffh );
+
+    __m128i vres = _mm_hadd_epi32( _mm_hadd_epi32( vsum0, vsum1 ), _mm_hadd_epi32( vsum2, vsum3 ) );
+    vres = _mm_srai_epi32( _mm_add_epi32( vres, voffh ), shiftH );
+
+    vrow[row] = _mm_packs_epi32( vres, vres );
+
+    src += srcStride;
+  }
+
+  __m128i vcoeffv[NTAPS_LUMA / 2];
+  for( int i = 0; i < NTAPS_LUMA; i += 2 )
+  {
+    vcoeffv[i / 2] = _mm_unpacklo_epi16( _mm_set1_epi16( coeffV[i] ), _mm_set1_epi16( coeffV[i + 1] ) );
+  }
+
+  __m128i voffv    = _mm_set1_epi32( offsetV );
+  __m128i vibdimin = _mm_set1_epi16( clpRng.min );
+  __m128i vibdimax = _mm_set1_epi16( clpRng.max );
+
+  for( row = 0; row < 4; row++ )
+  {
+    __m128i vsum = _mm_setzero_si128();
+    for( int i = 0; i < NTAPS_LUMA; i += 2 )
+    {
+      vsum = _mm_add_epi32( vsum, _mm_madd_epi16( _mm_unpacklo_epi16( vrow[row + i], vrow[row + i + 1] ), vcoeffv[i / 2] ) );
+    }
+    vsum = _mm_srai_epi32( _mm_add_epi32( vsum, voffv ), shiftV );
+    vsum = _mm_packs_epi32( vsum, vsum );
+
+    if( isLast )
+    {
+      vsum = _mm_min_epi16( vibdimax, _mm_max_epi16( vibdimin, vsum ) );
+    }
+
+    _mm_storel_epi64( ( __m128i * )&dst[row * dstStride], vsum );
+  }
+}
+
 template <X86_VEXT vext>
 void InterpolationFilter::_initInterpolationFilterX86()
 {
@@ -1162,6 +1400,9 @@ void InterpolationFilter::_initInterpolationFilterX86()
   m_filterCopy[0][1]   = simdFilterCopy<vext, false, true>;
   m_filterCopy[1][0]   = simdFilterCopy<vext, true, false>;
   m_filterCopy[1][1]   = simdFilterCopy<vext, true, true>;
+
+  m_filter4x4[0]       = simdFilter4x4_N8<vext, false>;
+  m_filter4x4[1]       = simdFilter4x4_N8<vext, true>;
 }
 
 template void InterpolationFilter::_initInterpolationFilterX86<SIMDX86>();
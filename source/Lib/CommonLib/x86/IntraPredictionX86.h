@@ -0,0 +1,192 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2017, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     IntraPredictionX86.h
+    \brief    SIMD luma down-sampling and parameter derivation for the cross-component linear model
+*/
+
+#include "CommonDefX86.h"
+#include "../IntraPrediction.h"
+
+//! \ingroup CommonLib
+//! \{
+
+#if ENABLE_SIMD_OPT_INTRA
+#ifdef TARGET_SIMD_X86
+
+template<X86_VEXT vext>
+static void simdLMLumaDownsample( const Pel* pRecSrc, int iRecStride, Pel* pDst, int iDstStride, int width, int height )
+{
+  // the two luma rows are summed first, each output is then r[2i-1] + 2 * r[2i] + r[2i+1], which is formed by
+  // one multiply-add on the pairs ( r[2i-1], r[2i] ) and one on the pairs ( r[2i], r[2i+1] )
+  const __m128i vcoeff0 = _mm_set1_epi32( 0x00020001 );
+  const __m128i vcoeff1 = _mm_set1_epi32( 0x00010000 );
+  const __m128i vround  = _mm_set1_epi32( 4 );
+
+  for( int j = 0; j < height; j++ )
+  {
+    const Pel* pRecSrc1 = pRecSrc + iRecStride;
+    int i = 0;
+
+#if USE_AVX2
+    if( vext >= AVX2 )
+    {
+      const __m256i vcoeff0x2 = _mm256_set1_epi32( 0x00020001 );
+      const __m256i vcoeff1x2 = _mm256_set1_epi32( 0x00010000 );
+      const __m256i vroundx2  = _mm256_set1_epi32( 4 );
+
+      for( ; i + 16 <= width; i += 16 )
+      {
+        __m256i vsum[2];
+
+        for( int k = 0; k < 2; k++ )
+        {
+          const int off = 2 * i + 16 * k;
+          __m256i vrow0 = _mm256_add_epi16( _mm256_loadu_si256( ( const __m256i* ) &pRecSrc[off - 1] ), _mm256_loadu_si256( ( const __m256i* ) &pRecSrc1[off - 1] ) );
+          __m256i vrow1 = _mm256_add_epi16( _mm256_loadu_si256( ( const __m256i* ) &pRecSrc[off    ] ), _mm256_loadu_si256( ( const __m256i* ) &pRecSrc1[off    ] ) );
+
+          vsum[k] = _mm256_add_epi32( _mm256_madd_epi16( vrow0, vcoeff0x2 ), _mm256_madd_epi16( vrow1, vcoeff1x2 ) );
+          vsum[k] = _mm256_srai_epi32( _mm256_add_epi32( vsum[k], vroundx2 ), 3 );
+        }
+
+        __m256i vdst = _mm256_permute4x64_epi64( _mm256_packs_epi32( vsum[0], vsum[1] ), 0xd8 );
+        _mm256_storeu_si256( ( __m256i* ) &pDst[i], vdst );
+      }
+    }
+#endif
+
+    for( ; i + 8 <= width; i += 8 )
+    {
+      __m128i vsum[2];
+
+      for( int k = 0; k < 2; k++ )
+      {
+        const int off = 2 * i + 8 * k;
+        __m128i vrow0 = _mm_add_epi16( _mm_loadu_si128( ( const __m128i* ) &pRecSrc[off - 1] ), _mm_loadu_si128( ( const __m128i* ) &pRecSrc1[off - 1] ) );
+        __m128i vrow1 = _mm_add_epi16( _mm_loadu_si128( ( const __m128i* ) &pRecSrc[off    ] ), _mm_loadu_si128( ( const __m128i* ) &pRecSrc1[off    ] ) );
+
+        vsum[k] = _mm_add_epi32( _mm_madd_epi16( vrow0, vcoeff0 ), _mm_madd_epi16( vrow1, vcoeff1 ) );
+        vsum[k] = _mm_srai_epi32( _mm_add_epi32( vsum[k], vround ), 3 );
+      }
+
+      _mm_storeu_si128( ( __m128i* ) &pDst[i], _mm_packs_epi32( vsum[0], vsum[1] ) );
+    }
+
+    for( ; i + 4 <= width; i += 4 )
+    {
+      __m128i vrow0 = _mm_add_epi16( _mm_loadu_si128( ( const __m128i* ) &pRecSrc[2 * i - 1] ), _mm_loadu_si128( ( const __m128i* ) &pRecSrc1[2 * i - 1] ) );
+      __m128i vrow1 = _mm_add_epi16( _mm_loadu_si128( ( const __m128i* ) &pRecSrc[2 * i    ] ), _mm_loadu_si128( ( const __m128i* ) &pRecSrc1[2 * i    ] ) );
+
+      __m128i vsum = _mm_add_epi32( _mm_madd_epi16( vrow0, vcoeff0 ), _mm_madd_epi16( vrow1, vcoeff1 ) );
+      vsum = _mm_srai_epi32( _mm_add_epi32( vsum, vround ), 3 );
+
+      _mm_storel_epi64( ( __m128i* ) &pDst[i], _mm_packs_epi32( vsum, vsum ) );
+    }
+
+    for( ; i < width; i++ )
+    {
+      pDst[i] = ( pRecSrc [2 * i] * 2 + pRecSrc [2 * i + 1] + pRecSrc [2 * i - 1]
+                + pRecSrc1[2 * i] * 2 + pRecSrc1[2 * i + 1] + pRecSrc1[2 * i - 1]
+                + 4 ) >> 3;
+    }
+
+    pDst    += iDstStride;
+    pRecSrc += iRecStride << 1;
+  }
+}
+
+template<X86_VEXT vext>
+static void simdLMAccumulate( const Pel* pLuma, const Pel* pChroma, int num, int& x, int& y, int& xx, int& xy )
+{
+  const __m128i vone = _mm_set1_epi16( 1 );
+
+  __m128i vx  = _mm_setzero_si128();
+  __m128i vy  = _mm_setzero_si128();
+  __m128i vxx = _mm_setzero_si128();
+  __m128i vxy = _mm_setzero_si128();
+
+  int n = 0;
+
+  for( ; n + 8 <= num; n += 8 )
+  {
+    __m128i vl = _mm_loadu_si128( ( const __m128i* ) &pLuma  [n] );
+    __m128i vc = _mm_loadu_si128( ( const __m128i* ) &pChroma[n] );
+
+    vx  = _mm_add_epi32( vx,  _mm_madd_epi16( vl, vone ) );
+    vy  = _mm_add_epi32( vy,  _mm_madd_epi16( vc, vone ) );
+    vxx = _mm_add_epi32( vxx, _mm_madd_epi16( vl, vl ) );
+    vxy = _mm_add_epi32( vxy, _mm_madd_epi16( vl, vc ) );
+  }
+
+  if( n + 4 <= num )
+  {
+    __m128i vl = _mm_loadl_epi64( ( const __m128i* ) &pLuma  [n] );
+    __m128i vc = _mm_loadl_epi64( ( const __m128i* ) &pChroma[n] );
+
+    vx  = _mm_add_epi32( vx,  _mm_madd_epi16( vl, vone ) );
+    vy  = _mm_add_epi32( vy,  _mm_madd_epi16( vc, vone ) );
+    vxx = _mm_add_epi32( vxx, _mm_madd_epi16( vl, vl ) );
+    vxy = _mm_add_epi32( vxy, _mm_madd_epi16( vl, vc ) );
+
+    n += 4;
+  }
+
+  // horizontal reduction of the four accumulators into ( x, y, xx, xy )
+  __m128i vsum = _mm_hadd_epi32( _mm_hadd_epi32( vx, vy ), _mm_hadd_epi32( vxx, vxy ) );
+
+  x  += _mm_extract_epi32( vsum, 0 );
+  y  += _mm_extract_epi32( vsum, 1 );
+  xx += _mm_extract_epi32( vsum, 2 );
+  xy += _mm_extract_epi32( vsum, 3 );
+
+  for( ; n < num; n++ )
+  {
+    x  += pLuma[n];
+    y  += pChroma[n];
+    xx += pLuma[n] * pLuma[n];
+    xy += pLuma[n] * pChroma[n];
+  }
+}
+
+template <X86_VEXT vext>
+void IntraPrediction::_initIntraPredictionX86()
+{
+  m_lmLumaDownsample = simdLMLumaDownsample<vext>;
+  m_lmAccumulate     = simdLMAccumulate<vext>;
+}
+
+template void IntraPrediction::_initIntraPredictionX86<SIMDX86>();
+
+#endif //#ifdef TARGET_SIMD_X86
+#endif
+//! \}
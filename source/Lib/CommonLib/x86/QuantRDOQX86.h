@@ -0,0 +1,126 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2017, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     QuantRDOQX86.h
+    \brief    SIMD pre-quantization for RDOQ
+*/
+
+#include "CommonDefX86.h"
+#include "../QuantRDOQ.h"
+
+#include <limits>
+
+//! \ingroup CommonLib
+//! \{
+
+#if ENABLE_SIMD_OPT_QUANT
+#ifdef TARGET_SIMD_X86
+
+template<X86_VEXT vext>
+static void simdPreQuant( const TCoeff* src, Intermediate_Int* levelDouble, uint32_t* maxAbsLevel, const int numCoeff, const int quantCoeff, const int iQBits, const TCoeff entropyCodingMaximum )
+{
+  const Intermediate_Int half           = Intermediate_Int( 1 ) << ( iQBits - 1 );
+  const Intermediate_Int maxLevelDouble = std::numeric_limits<Intermediate_Int>::max() - half;
+
+  int n = 0;
+
+  // the 32x32 bit products are computed as 64 bit values (even and odd lanes), the result is
+  // clipped to maxLevelDouble if either the high part is set or the low part exceeds the limit
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    const __m256i vq      = _mm256_set1_epi32( quantCoeff );
+    const __m256i vlimit  = _mm256_set1_epi32( maxLevelDouble );
+    const __m256i vhalf   = _mm256_set1_epi32( half );
+    const __m256i vmaxlvl = _mm256_set1_epi32( entropyCodingMaximum );
+    const __m256i vzero   = _mm256_setzero_si256();
+    const __m128i vshift  = _mm_cvtsi32_si128( iQBits );
+
+    for( ; n + 8 <= numCoeff; n += 8 )
+    {
+      __m256i vabs  = _mm256_abs_epi32( _mm256_loadu_si256( ( const __m256i* ) &src[n] ) );
+      __m256i veven = _mm256_mul_epu32( vabs, vq );
+      __m256i vodd  = _mm256_mul_epu32( _mm256_srli_epi64( vabs, 32 ), vq );
+      __m256i vlo   = _mm256_blend_epi32( veven, _mm256_slli_epi64( vodd, 32 ), 0xAA );
+      __m256i vhi   = _mm256_blend_epi32( _mm256_srli_epi64( veven, 32 ), vodd, 0xAA );
+      __m256i vlev  = _mm256_blendv_epi8( vlimit, _mm256_min_epu32( vlo, vlimit ), _mm256_cmpeq_epi32( vhi, vzero ) );
+      __m256i vmax  = _mm256_min_epu32( _mm256_srl_epi32( _mm256_add_epi32( vlev, vhalf ), vshift ), vmaxlvl );
+
+      _mm256_storeu_si256( ( __m256i* ) &levelDouble[n], vlev );
+      _mm256_storeu_si256( ( __m256i* ) &maxAbsLevel[n], vmax );
+    }
+  }
+#endif
+  {
+    const __m128i vq      = _mm_set1_epi32( quantCoeff );
+    const __m128i vlimit  = _mm_set1_epi32( maxLevelDouble );
+    const __m128i vhalf   = _mm_set1_epi32( half );
+    const __m128i vmaxlvl = _mm_set1_epi32( entropyCodingMaximum );
+    const __m128i vzero   = _mm_setzero_si128();
+    const __m128i vshift  = _mm_cvtsi32_si128( iQBits );
+
+    for( ; n + 4 <= numCoeff; n += 4 )
+    {
+      __m128i vabs  = _mm_abs_epi32( _mm_loadu_si128( ( const __m128i* ) &src[n] ) );
+      __m128i veven = _mm_mul_epu32( vabs, vq );
+      __m128i vodd  = _mm_mul_epu32( _mm_srli_epi64( vabs, 32 ), vq );
+      __m128i vlo   = _mm_blend_epi16( veven, _mm_slli_epi64( vodd, 32 ), 0xCC );
+      __m128i vhi   = _mm_blend_epi16( _mm_srli_epi64( veven, 32 ), vodd, 0xCC );
+      __m128i vlev  = _mm_blendv_epi8( vlimit, _mm_min_epu32( vlo, vlimit ), _mm_cmpeq_epi32( vhi, vzero ) );
+      __m128i vmax  = _mm_min_epu32( _mm_srl_epi32( _mm_add_epi32( vlev, vhalf ), vshift ), vmaxlvl );
+
+      _mm_storeu_si128( ( __m128i* ) &levelDouble[n], vlev );
+      _mm_storeu_si128( ( __m128i* ) &maxAbsLevel[n], vmax );
+    }
+  }
+
+  for( ; n < numCoeff; n++ )
+  {
+    const int64_t tmpLevel = int64_t( abs( src[n] ) ) * quantCoeff;
+
+    levelDouble[n] = ( Intermediate_Int ) std::min<int64_t>( tmpLevel, maxLevelDouble );
+    maxAbsLevel[n] = std::min<uint32_t>( uint32_t( entropyCodingMaximum ), uint32_t( ( levelDouble[n] + half ) >> iQBits ) );
+  }
+}
+
+template <X86_VEXT vext>
+void QuantRDOQ::_initQuantRDOQX86()
+{
+  m_preQuant = simdPreQuant<vext>;
+}
+
+template void QuantRDOQ::_initQuantRDOQX86<SIMDX86>();
+
+#endif //#ifdef TARGET_SIMD_X86
+#endif
+//! \}
@@ -43,10 +43,46 @@
 
 #ifdef TARGET_SIMD_X86
 
+#ifdef USE_AVX512
+static inline Distortion xCalcSSE_AVX512( const Pel* pSrc1, const int iStrideSrc1, const Pel* pSrc2, const int iStrideSrc2, const int iCols, const int iRows )
+{
+  // the row sums are widened to 64 bit, a 128x128 block of 10 bit samples can exceed 32 bit
+  const __mmask32 tailMask = ( __mmask32 ) ( ( 1ull << ( iCols & 31 ) ) - 1 );
+  const __m512i vmask32    = _mm512_set1_epi64( 0xffffffff );
+  __m512i vsum64 = _mm512_setzero_si512();
+  for( int iY = 0; iY < iRows; iY++ )
+  {
+    __m512i vsum32 = _mm512_setzero_si512();
+    int iX = 0;
+    for( ; iX + 32 <= iCols; iX += 32 )
+    {
+      __m512i vdiff = _mm512_sub_epi16( _mm512_loadu_si512( ( const void* ) &pSrc1[iX] ), _mm512_loadu_si512( ( const void* ) &pSrc2[iX] ) );
+      vsum32 = _mm512_add_epi32( vsum32, _mm512_madd_epi16( vdiff, vdiff ) );
+    }
+    if( tailMask )
+    {
+      __m512i vdiff = _mm512_sub_epi16( _mm512_maskz_loadu_epi16( tailMask, &pSrc1[iX] ), _mm512_maskz_loadu_epi16( tailMask, &pSrc2[iX] ) );
+      vsum32 = _mm512_add_epi32( vsum32, _mm512_madd_epi16( vdiff, vdiff ) );
+    }
+    vsum64 = _mm512_add_epi64( vsum64, _mm512_add_epi64( _mm512_and_si512( vsum32, vmask32 ), _mm512_srli_epi64( vsum32, 32 ) ) );
+    pSrc1 += iStrideSrc1;
+    pSrc2 += iStrideSrc2;
+  }
+  uint64_t sum[8];
+  _mm512_storeu_si512( ( void* ) sum, vsum64 );
+  Distortion uiSum = 0;
+  for( int k = 0; k < 8; k++ )
+  {
+    uiSum += sum[k];
+  }
+  return uiSum;
+}
+#endif
+
 template< typename Torg, typename Tcur, X86_VEXT vext >
 Distortion RdCost::xGetSSE_SIMD( const DistParam &rcDtParam )
 {
-  if( rcDtParam.bitDepth > 10 )
+  if( rcDtParam.bitDepth > 10 || rcDtParam.applyWeight )
     return RdCost::xGetSSE( rcDtParam );
 
   const Torg* pSrc1     = (const Torg*)rcDtParam.org.buf;
@@ -59,7 +95,13 @@ Distortion RdCost::xGetSSE_SIMD( const DistParam &rcDtParam )
   const uint32_t uiShift = DISTORTION_PRECISION_ADJUSTMENT(rcDtParam.bitDepth) << 1;
   unsigned int uiRet = 0;
 
-  if( vext >= AVX2 && ( iCols & 15 ) == 0 )
+  if( vext >= AVX512 && sizeof( Torg ) > 1 && sizeof( Tcur ) > 1 )
+  {
+#ifdef USE_AVX512
+    return xCalcSSE_AVX512( ( const Pel* ) pSrc1, iStrideSrc1, ( const Pel* ) pSrc2, iStrideSrc2, iCols, iRows ) >> uiShift;
+#endif
+  }
+  else if( vext >= AVX2 && ( iCols & 15 ) == 0 )
   {
 #ifdef USE_AVX2
     __m256i Sum = _mm256_setzero_si256();
@@ -140,7 +182,13 @@ Distortion RdCost::xGetSSE_NxN_SIMD( const DistParam &rcDtParam )
   const uint32_t uiShift = DISTORTION_PRECISION_ADJUSTMENT(rcDtParam.bitDepth) << 1;
   unsigned int uiRet = 0;
 
-  if( 4 == iWidth )
+  if( vext >= AVX512 && sizeof( Torg ) > 1 && sizeof( Tcur ) > 1 )
+  {
+#ifdef USE_AVX512
+    return xCalcSSE_AVX512( ( const Pel* ) pSrc1, iStrideSrc1, ( const Pel* ) pSrc2, iStrideSrc2, iWidth, iRows ) >> uiShift;
+#endif
+  }
+  else if( 4 == iWidth )
   {
     __m128i Sum = _mm_setzero_si128();
     for( int iY = 0; iY < iRows; iY++ )
@@ -220,7 +268,29 @@ Distortion RdCost::xGetSAD_SIMD( const DistParam &rcDtParam )
   const int iStrideSrc2 = rcDtParam.cur.stride * iSubStep;
 
   uint32_t uiSum = 0;
-  if( vext >= AVX2 && ( iCols & 15 ) == 0 )
+  if( vext >= AVX512 && ( iCols & 31 ) == 0 )
+  {
+#ifdef USE_AVX512
+    // Do for width that multiple of 32
+    __m512i vone   = _mm512_set1_epi16( 1 );
+    __m512i vsum32 = _mm512_setzero_si512();
+    for( int iY = 0; iY < iRows; iY+=iSubStep )
+    {
+      __m512i vsum16 = _mm512_setzero_si512();
+      for( int iX = 0; iX < iCols; iX+=32 )
+      {
+        __m512i vsrc1 = _mm512_loadu_si512( ( const void* )( &pSrc1[iX] ) );
+        __m512i vsrc2 = _mm512_loadu_si512( ( const void* )( &pSrc2[iX] ) );
+        vsum16 = _mm512_add_epi16( vsum16, _mm512_abs_epi16( _mm512_sub_epi16( vsrc1, vsrc2 ) ) );
+      }
+      vsum32 = _mm512_add_epi32( vsum32, _mm512_madd_epi16( vsum16, vone ) );
+      pSrc1   += iStrideSrc1;
+      pSrc2   += iStrideSrc2;
+    }
+    uiSum = _mm512_reduce_add_epi32( vsum32 );
+#endif
+  }
+  else if( vext >= AVX2 && ( iCols & 15 ) == 0 )
   {
 #ifdef USE_AVX2
     // Do for width that multiple of 16
@@ -298,6 +368,145 @@ Distortion RdCost::xGetSAD_SIMD( const DistParam &rcDtParam )
 }
 
 
+static inline __m128i xHorAddX4( const __m128i vsum32[4] )
+{
+  // one 32-bit lane per candidate
+  return _mm_hadd_epi32( _mm_hadd_epi32( vsum32[0], vsum32[1] ), _mm_hadd_epi32( vsum32[2], vsum32[3] ) );
+}
+
+#ifdef USE_AVX2
+static inline __m128i xFoldX4( const __m256i vsum32[4] )
+{
+  const __m128i vsum[4] = { _mm_add_epi32( _mm256_castsi256_si128( vsum32[0] ), _mm256_extracti128_si256( vsum32[0], 1 ) ),
+                            _mm_add_epi32( _mm256_castsi256_si128( vsum32[1] ), _mm256_extracti128_si256( vsum32[1], 1 ) ),
+                            _mm_add_epi32( _mm256_castsi256_si128( vsum32[2] ), _mm256_extracti128_si256( vsum32[2], 1 ) ),
+                            _mm_add_epi32( _mm256_castsi256_si128( vsum32[3] ), _mm256_extracti128_si256( vsum32[3], 1 ) ) };
+  return xHorAddX4( vsum );
+}
+#endif
+
+static inline bool xAllAboveX4( const __m128i &vsum, const int iSubShift, const uint32_t distortionShift, const Distortion maxDist )
+{
+  uint32_t sum[4];
+  _mm_storeu_si128( ( __m128i* ) sum, vsum );
+  for( int k = 0; k < 4; k++ )
+  {
+    if( ( ( Distortion( sum[k] ) << iSubShift ) >> distortionShift ) <= maxDist )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template< X86_VEXT vext >
+void RdCost::xGetSADx4_SIMD( const DistParam &rcDtParam, const Pel* const cur[4], Distortion dist[4] )
+{
+  if( rcDtParam.org.width < 4 || ( rcDtParam.org.width & 3 ) || rcDtParam.bitDepth > 10 || rcDtParam.applyWeight || rcDtParam.useMR )
+  {
+    RdCost::xGetSADx4( rcDtParam, cur, dist );
+    return;
+  }
+
+  const short* pOrg    = (const short*)rcDtParam.org.buf;
+  const short* pCur[4] = { (const short*)cur[0], (const short*)cur[1], (const short*)cur[2], (const short*)cur[3] };
+  const int  iRows     = rcDtParam.org.height;
+  const int  iCols     = rcDtParam.org.width;
+  const int  iSubShift = rcDtParam.subShift;
+  const int  iSubStep  = ( 1 << iSubShift );
+  const int  iStrideOrg = rcDtParam.org.stride * iSubStep;
+  const int  iStrideCur = rcDtParam.cur.stride * iSubStep;
+  const uint32_t   distortionShift = DISTORTION_PRECISION_ADJUSTMENT( rcDtParam.bitDepth );
+  const Distortion maxDist         = rcDtParam.maximumDistortionForEarlyExit;
+
+  __m128i vzero = _mm_setzero_si128();
+  __m128i vsum  = vzero;
+
+  if( vext >= AVX2 && ( iCols & 15 ) == 0 )
+  {
+#ifdef USE_AVX2
+    // Do for width that multiple of 16, the original samples are loaded once for all four candidates
+    __m256i vzero256  = _mm256_setzero_si256();
+    __m256i vsum32[4] = { vzero256, vzero256, vzero256, vzero256 };
+    for( int iY = 0; iY < iRows; iY += iSubStep )
+    {
+      __m256i vsum16[4] = { vzero256, vzero256, vzero256, vzero256 };
+      for( int iX = 0; iX < iCols; iX += 16 )
+      {
+        __m256i vorg = _mm256_lddqu_si256( ( __m256i* )( &pOrg[iX] ) );
+        for( int k = 0; k < 4; k++ )
+        {
+          __m256i vcur = _mm256_lddqu_si256( ( __m256i* )( &pCur[k][iX] ) );
+          vsum16[k] = _mm256_add_epi16( vsum16[k], _mm256_abs_epi16( _mm256_sub_epi16( vorg, vcur ) ) );
+        }
+      }
+      for( int k = 0; k < 4; k++ )
+      {
+        vsum32[k] = _mm256_add_epi32( vsum32[k], _mm256_add_epi32( _mm256_unpacklo_epi16( vsum16[k], vzero256 ), _mm256_unpackhi_epi16( vsum16[k], vzero256 ) ) );
+        pCur[k]  += iStrideCur;
+      }
+      pOrg += iStrideOrg;
+
+      // check every 8 rows whether all candidates are already worse than the best one
+      if( ( ( iY >> iSubShift ) & 7 ) == 7 && iY + iSubStep < iRows && xAllAboveX4( xFoldX4( vsum32 ), iSubShift, distortionShift, maxDist ) )
+      {
+        break;
+      }
+    }
+    vsum = xFoldX4( vsum32 );
+#endif
+  }
+  else
+  {
+    // Do with step of 8 and a remainder of 4, the original samples are loaded once for all four candidates
+    __m128i vsum32[4] = { vzero, vzero, vzero, vzero };
+    for( int iY = 0; iY < iRows; iY += iSubStep )
+    {
+      __m128i vsum16[4] = { vzero, vzero, vzero, vzero };
+      int iX = 0;
+      for( ; iX + 8 <= iCols; iX += 8 )
+      {
+        __m128i vorg = _mm_loadu_si128( ( const __m128i* )( &pOrg[iX] ) );
+        for( int k = 0; k < 4; k++ )
+        {
+          __m128i vcur = _mm_lddqu_si128( ( const __m128i* )( &pCur[k][iX] ) );
+          vsum16[k] = _mm_add_epi16( vsum16[k], _mm_abs_epi16( _mm_sub_epi16( vorg, vcur ) ) );
+        }
+      }
+      if( iX < iCols )
+      {
+        __m128i vorg = _mm_loadl_epi64( ( const __m128i* )( &pOrg[iX] ) );
+        for( int k = 0; k < 4; k++ )
+        {
+          __m128i vcur = _mm_loadl_epi64( ( const __m128i* )( &pCur[k][iX] ) );
+          vsum16[k] = _mm_add_epi16( vsum16[k], _mm_abs_epi16( _mm_sub_epi16( vorg, vcur ) ) );
+        }
+      }
+      for( int k = 0; k < 4; k++ )
+      {
+        vsum32[k] = _mm_add_epi32( vsum32[k], _mm_add_epi32( _mm_unpacklo_epi16( vsum16[k], vzero ), _mm_unpackhi_epi16( vsum16[k], vzero ) ) );
+        pCur[k]  += iStrideCur;
+      }
+      pOrg += iStrideOrg;
+
+      // check every 8 rows whether all candidates are already worse than the best one
+      if( ( ( iY >> iSubShift ) & 7 ) == 7 && iY + iSubStep < iRows && xAllAboveX4( xHorAddX4( vsum32 ), iSubShift, distortionShift, maxDist ) )
+      {
+        break;
+      }
+    }
+    vsum = xHorAddX4( vsum32 );
+  }
+
+  uint32_t sum[4];
+  _mm_storeu_si128( ( __m128i* ) sum, vsum );
+  for( int k = 0; k < 4; k++ )
+  {
+    dist[k] = ( Distortion( sum[k] ) << iSubShift ) >> distortionShift;
+  }
+}
+
+
 template< int iWidth, X86_VEXT vext >
 Distortion RdCost::xGetSAD_NxN_SIMD( const DistParam &rcDtParam )
 {
@@ -361,7 +570,29 @@ Distortion RdCost::xGetSAD_NxN_SIMD( const DistParam &rcDtParam )
   }
   else
   {
-    if( vext >= AVX2 && iWidth >= 16 )
+    if( vext >= AVX512 && iWidth >= 32 )
+    {
+#ifdef USE_AVX512
+      // Do for width that multiple of 32
+      __m512i vone   = _mm512_set1_epi16( 1 );
+      __m512i vsum32 = _mm512_setzero_si512();
+      for( int iY = 0; iY < iRows; iY+=iSubStep )
+      {
+        __m512i vsum16 = _mm512_setzero_si512();
+        for( int iX = 0; iX < iWidth; iX+=32 )
+        {
+          __m512i vsrc1 = _mm512_loadu_si512( ( const void* )( &pSrc1[iX] ) );
+          __m512i vsrc2 = _mm512_loadu_si512( ( const void* )( &pSrc2[iX] ) );
+          vsum16 = _mm512_add_epi16( vsum16, _mm512_abs_epi16( _mm512_sub_epi16( vsrc1, vsrc2 ) ) );
+        }
+        vsum32 = _mm512_add_epi32( vsum32, _mm512_madd_epi16( vsum16, vone ) );
+        pSrc1   += iStrideSrc1;
+        pSrc2   += iStrideSrc2;
+      }
+      uiSum = _mm512_reduce_add_epi32( vsum32 );
+#endif
+    }
+    else if( vext >= AVX2 && iWidth >= 16 )
     {
 #ifdef USE_AVX2
       // Do for width that multiple of 16
@@ -1548,14 +1779,15 @@ static uint32_t xCalcHAD4x8_SSE( const Torg *piOrg, const Tcur *piCur, const int
 }
 
 
+// each pass of 8 rows transforms two horizontally adjacent 8x8 tiles and rounds them like xCalcHAD8x8_SSE,
+// iLoops = 1 gives the pair of 8x8 tiles of xCalcHAD8x8x2_AVX2
 template< typename Torg, typename Tcur/*, bool bHorDownsampling*/ >
-static uint32_t xCalcHAD16x16_AVX2( const Torg *piOrg, const Tcur *piCur, const int iStrideOrg, const int iStrideCur, const int iBitDepth )
+static uint32_t xCalcHAD16x16_AVX2( const Torg *piOrg, const Tcur *piCur, const int iStrideOrg, const int iStrideCur, const int iBitDepth, const int iLoops = 2 )
 {
   uint32_t sad = 0;
 
 #ifdef USE_AVX2
   // const int iLoops = ( bHorDownsampling && HAD_DOWNSAMPLING_HOR ) ? ( 1 ) : ( 2 );
-  const int iLoops = 2;
   __m256i m1[8], m2[8];
 
   for( int l = 0; l < iLoops; l++ )
@@ -1741,6 +1973,263 @@ static uint32_t xCalcHAD16x16_AVX2( const Torg *piOrg, const Tcur *piCur, const
   return ( sad );
 }
 
+template< typename Torg, typename Tcur >
+static uint32_t xCalcHAD16x16_AVX512( const Torg *piOrg, const Tcur *piCur, const int iStrideOrg, const int iStrideCur, const int iBitDepth )
+{
+  uint32_t sad = 0;
+
+#ifdef USE_AVX512
+  // same 8x8 transforms as xCalcHAD16x16_AVX2, the rows 8..15 are processed in the upper 256 bits
+  // instead of a second pass, so each 128 bit lane holds one of the four 8x8 tiles
+  __m512i m1[8], m2[8];
+
+  for( int k = 0; k < 8; k++ )
+  {
+    __m512i r0 = _mm512_mask_loadu_epi16( _mm512_maskz_loadu_epi16( 0xffff, piOrg ), 0xffff0000, piOrg + 8 * iStrideOrg - 16 );
+    __m512i r1 = _mm512_mask_loadu_epi16( _mm512_maskz_loadu_epi16( 0xffff, piCur ), 0xffff0000, piCur + 8 * iStrideCur - 16 );
+    m2[k] = _mm512_sub_epi16( r0, r1 );
+    piCur += iStrideCur;
+    piOrg += iStrideOrg;
+  }
+
+  // horizontal
+
+  m1[0] = _mm512_add_epi16( m2[0], m2[4] );
+  m1[1] = _mm512_add_epi16( m2[1], m2[5] );
+  m1[2] = _mm512_add_epi16( m2[2], m2[6] );
+  m1[3] = _mm512_add_epi16( m2[3], m2[7] );
+  m1[4] = _mm512_sub_epi16( m2[0], m2[4] );
+  m1[5] = _mm512_sub_epi16( m2[1], m2[5] );
+  m1[6] = _mm512_sub_epi16( m2[2], m2[6] );
+  m1[7] = _mm512_sub_epi16( m2[3], m2[7] );
+
+  m2[0] = _mm512_add_epi16( m1[0], m1[2] );
+  m2[1] = _mm512_add_epi16( m1[1], m1[3] );
+  m2[2] = _mm512_sub_epi16( m1[0], m1[2] );
+  m2[3] = _mm512_sub_epi16( m1[1], m1[3] );
+  m2[4] = _mm512_add_epi16( m1[4], m1[6] );
+  m2[5] = _mm512_add_epi16( m1[5], m1[7] );
+  m2[6] = _mm512_sub_epi16( m1[4], m1[6] );
+  m2[7] = _mm512_sub_epi16( m1[5], m1[7] );
+
+  m1[0] = _mm512_add_epi16( m2[0], m2[1] );
+  m1[1] = _mm512_sub_epi16( m2[0], m2[1] );
+  m1[2] = _mm512_add_epi16( m2[2], m2[3] );
+  m1[3] = _mm512_sub_epi16( m2[2], m2[3] );
+  m1[4] = _mm512_add_epi16( m2[4], m2[5] );
+  m1[5] = _mm512_sub_epi16( m2[4], m2[5] );
+  m1[6] = _mm512_add_epi16( m2[6], m2[7] );
+  m1[7] = _mm512_sub_epi16( m2[6], m2[7] );
+
+  // transpose 4 8x8 blocks in parallel
+
+  m2[0] = _mm512_unpacklo_epi16( m1[0], m1[1] );
+  m2[1] = _mm512_unpacklo_epi16( m1[2], m1[3] );
+  m2[2] = _mm512_unpacklo_epi16( m1[4], m1[5] );
+  m2[3] = _mm512_unpacklo_epi16( m1[6], m1[7] );
+  m2[4] = _mm512_unpackhi_epi16( m1[0], m1[1] );
+  m2[5] = _mm512_unpackhi_epi16( m1[2], m1[3] );
+  m2[6] = _mm512_unpackhi_epi16( m1[4], m1[5] );
+  m2[7] = _mm512_unpackhi_epi16( m1[6], m1[7] );
+
+  m1[0] = _mm512_unpacklo_epi32( m2[0], m2[1] );
+  m1[1] = _mm512_unpackhi_epi32( m2[0], m2[1] );
+  m1[2] = _mm512_unpacklo_epi32( m2[2], m2[3] );
+  m1[3] = _mm512_unpackhi_epi32( m2[2], m2[3] );
+  m1[4] = _mm512_unpacklo_epi32( m2[4], m2[5] );
+  m1[5] = _mm512_unpackhi_epi32( m2[4], m2[5] );
+  m1[6] = _mm512_unpacklo_epi32( m2[6], m2[7] );
+  m1[7] = _mm512_unpackhi_epi32( m2[6], m2[7] );
+
+  m2[0] = _mm512_unpacklo_epi64( m1[0], m1[2] );
+  m2[1] = _mm512_unpackhi_epi64( m1[0], m1[2] );
+  m2[2] = _mm512_unpacklo_epi64( m1[1], m1[3] );
+  m2[3] = _mm512_unpackhi_epi64( m1[1], m1[3] );
+  m2[4] = _mm512_unpacklo_epi64( m1[4], m1[6] );
+  m2[5] = _mm512_unpackhi_epi64( m1[4], m1[6] );
+  m2[6] = _mm512_unpacklo_epi64( m1[5], m1[7] );
+  m2[7] = _mm512_unpackhi_epi64( m1[5], m1[7] );
+
+  // vertical
+  if( iBitDepth >= 10 )
+  {
+    __m512i n1[8][2];
+    __m512i n2[8][2];
+
+    for( int i = 0; i < 8; i++ )
+    {
+      // sign extension inside the 128 bit lanes
+      n2[i][0] = _mm512_srai_epi32( _mm512_unpacklo_epi16( m2[i], m2[i] ), 16 );
+      n2[i][1] = _mm512_srai_epi32( _mm512_unpackhi_epi16( m2[i], m2[i] ), 16 );
+    }
+
+    for( int i = 0; i < 2; i++ )
+    {
+      n1[0][i] = _mm512_add_epi32( n2[0][i], n2[4][i] );
+      n1[1][i] = _mm512_add_epi32( n2[1][i], n2[5][i] );
+      n1[2][i] = _mm512_add_epi32( n2[2][i], n2[6][i] );
+      n1[3][i] = _mm512_add_epi32( n2[3][i], n2[7][i] );
+      n1[4][i] = _mm512_sub_epi32( n2[0][i], n2[4][i] );
+      n1[5][i] = _mm512_sub_epi32( n2[1][i], n2[5][i] );
+      n1[6][i] = _mm512_sub_epi32( n2[2][i], n2[6][i] );
+      n1[7][i] = _mm512_sub_epi32( n2[3][i], n2[7][i] );
+
+      n2[0][i] = _mm512_add_epi32( n1[0][i], n1[2][i] );
+      n2[1][i] = _mm512_add_epi32( n1[1][i], n1[3][i] );
+      n2[2][i] = _mm512_sub_epi32( n1[0][i], n1[2][i] );
+      n2[3][i] = _mm512_sub_epi32( n1[1][i], n1[3][i] );
+      n2[4][i] = _mm512_add_epi32( n1[4][i], n1[6][i] );
+      n2[5][i] = _mm512_add_epi32( n1[5][i], n1[7][i] );
+      n2[6][i] = _mm512_sub_epi32( n1[4][i], n1[6][i] );
+      n2[7][i] = _mm512_sub_epi32( n1[5][i], n1[7][i] );
+
+      n1[0][i] = _mm512_abs_epi32( _mm512_add_epi32( n2[0][i], n2[1][i] ) );
+      n1[1][i] = _mm512_abs_epi32( _mm512_sub_epi32( n2[0][i], n2[1][i] ) );
+      n1[2][i] = _mm512_abs_epi32( _mm512_add_epi32( n2[2][i], n2[3][i] ) );
+      n1[3][i] = _mm512_abs_epi32( _mm512_sub_epi32( n2[2][i], n2[3][i] ) );
+      n1[4][i] = _mm512_abs_epi32( _mm512_add_epi32( n2[4][i], n2[5][i] ) );
+      n1[5][i] = _mm512_abs_epi32( _mm512_sub_epi32( n2[4][i], n2[5][i] ) );
+      n1[6][i] = _mm512_abs_epi32( _mm512_add_epi32( n2[6][i], n2[7][i] ) );
+      n1[7][i] = _mm512_abs_epi32( _mm512_sub_epi32( n2[6][i], n2[7][i] ) );
+    }
+    for( int i = 0; i < 8; i++ )
+    {
+      m1[i] = _mm512_add_epi32( n1[i][0], n1[i][1] );
+    }
+  }
+  else
+  {
+    m1[0] = _mm512_add_epi16( m2[0], m2[4] );
+    m1[1] = _mm512_add_epi16( m2[1], m2[5] );
+    m1[2] = _mm512_add_epi16( m2[2], m2[6] );
+    m1[3] = _mm512_add_epi16( m2[3], m2[7] );
+    m1[4] = _mm512_sub_epi16( m2[0], m2[4] );
+    m1[5] = _mm512_sub_epi16( m2[1], m2[5] );
+    m1[6] = _mm512_sub_epi16( m2[2], m2[6] );
+    m1[7] = _mm512_sub_epi16( m2[3], m2[7] );
+
+    m2[0] = _mm512_add_epi16( m1[0], m1[2] );
+    m2[1] = _mm512_add_epi16( m1[1], m1[3] );
+    m2[2] = _mm512_sub_epi16( m1[0], m1[2] );
+    m2[3] = _mm512_sub_epi16( m1[1], m1[3] );
+    m2[4] = _mm512_add_epi16( m1[4], m1[6] );
+    m2[5] = _mm512_add_epi16( m1[5], m1[7] );
+    m2[6] = _mm512_sub_epi16( m1[4], m1[6] );
+    m2[7] = _mm512_sub_epi16( m1[5], m1[7] );
+
+    m1[0] = _mm512_abs_epi16( _mm512_add_epi16( m2[0], m2[1] ) );
+    m1[1] = _mm512_abs_epi16( _mm512_sub_epi16( m2[0], m2[1] ) );
+    m1[2] = _mm512_abs_epi16( _mm512_add_epi16( m2[2], m2[3] ) );
+    m1[3] = _mm512_abs_epi16( _mm512_sub_epi16( m2[2], m2[3] ) );
+    m1[4] = _mm512_abs_epi16( _mm512_add_epi16( m2[4], m2[5] ) );
+    m1[5] = _mm512_abs_epi16( _mm512_sub_epi16( m2[4], m2[5] ) );
+    m1[6] = _mm512_abs_epi16( _mm512_add_epi16( m2[6], m2[7] ) );
+    m1[7] = _mm512_abs_epi16( _mm512_sub_epi16( m2[6], m2[7] ) );
+
+    __m512i vzero = _mm512_setzero_si512();
+
+    for( int i = 0; i < 8; i++ )
+    {
+      m1[i] = _mm512_add_epi32( _mm512_unpacklo_epi16( m1[i], vzero ), _mm512_unpackhi_epi16( m1[i], vzero ) );
+    }
+  }
+
+  m1[0] = _mm512_add_epi32( m1[0], m1[1] );
+  m1[2] = _mm512_add_epi32( m1[2], m1[3] );
+  m1[4] = _mm512_add_epi32( m1[4], m1[5] );
+  m1[6] = _mm512_add_epi32( m1[6], m1[7] );
+
+  m1[0] = _mm512_add_epi32( m1[0], m1[2] );
+  m1[4] = _mm512_add_epi32( m1[4], m1[6] );
+
+  __m512i iSum = _mm512_add_epi32( m1[0], m1[4] );
+  iSum = _mm512_add_epi32( iSum, _mm512_shuffle_epi32( iSum, ( _MM_PERM_ENUM ) 0x4e ) );
+  iSum = _mm512_add_epi32( iSum, _mm512_shuffle_epi32( iSum, ( _MM_PERM_ENUM ) 0xb1 ) );
+
+  uint32_t tmp[16];
+  _mm512_storeu_si512( ( void* ) tmp, iSum );
+  for( int i = 0; i < 16; i += 4 )
+  {
+    sad += ( tmp[i] + 2 ) >> 2;
+  }
+
+#endif
+  return ( sad );
+}
+
+template< typename Torg, typename Tcur >
+static uint32_t xCalcHAD8x8x2_AVX2( const Torg *piOrg, const Tcur *piCur, const int iStrideOrg, const int iStrideCur, const int iBitDepth )
+{
+  return xCalcHAD16x16_AVX2<Torg, Tcur>( piOrg, piCur, iStrideOrg, iStrideCur, iBitDepth, 1 );
+}
+
+template< typename Torg, typename Tcur >
+static uint32_t xCalcHAD4x4x2_AVX2( const Torg *piOrg, const Tcur *piCur, const int iStrideOrg, const int iStrideCur )
+{
+  uint32_t sad = 0;
+
+#ifdef USE_AVX2
+  // same steps as xCalcHAD4x4_SSE, the left tile in the lower and the right tile in the upper 128 bit lane
+  __m256i r[4];
+
+  for( int k = 0; k < 4; k++ )
+  {
+    __m128i r0 = ( sizeof( Torg ) > 1 ) ? ( _mm_lddqu_si128( ( const __m128i* )&piOrg[k * iStrideOrg] ) ) : ( _mm_cvtepu8_epi16( _mm_loadl_epi64( ( const __m128i* )&piOrg[k * iStrideOrg] ) ) );
+    __m128i r1 = ( sizeof( Tcur ) > 1 ) ? ( _mm_lddqu_si128( ( const __m128i* )&piCur[k * iStrideCur] ) ) : ( _mm_cvtepu8_epi16( _mm_loadl_epi64( ( const __m128i* )&piCur[k * iStrideCur] ) ) );
+    __m128i d  = _mm_sub_epi16( r0, r1 );
+    r[k] = _mm256_inserti128_si256( _mm256_castsi128_si256( d ), _mm_srli_si128( d, 8 ), 1 );
+  }
+
+  // first stage
+  __m256i r0 = _mm256_add_epi16( r[0], r[3] );
+  __m256i r1 = _mm256_add_epi16( r[1], r[2] );
+  __m256i r4 = _mm256_sub_epi16( r[0], r[3] );
+  __m256i r5 = _mm256_sub_epi16( r[1], r[2] );
+
+  __m256i r2 = _mm256_sub_epi16( r0, r1 );
+  __m256i r3 = _mm256_sub_epi16( r4, r5 );
+  r0 = _mm256_add_epi16( r0, r1 );
+  r5 = _mm256_add_epi16( r5, r4 );
+
+  // shuffle - flip matrix for vertical transform
+  r0 = _mm256_unpacklo_epi16( r0, r5 );
+  r2 = _mm256_unpacklo_epi16( r2, r3 );
+
+  r3 = _mm256_unpackhi_epi32( r0, r2 );
+  r0 = _mm256_unpacklo_epi32( r0, r2 );
+
+  r1 = _mm256_srli_si256( r0, 8 );
+  r2 = r3;
+  r3 = _mm256_srli_si256( r3, 8 );
+
+  // second stage
+  r4 = _mm256_sub_epi16( r0, r3 );
+  r5 = _mm256_sub_epi16( r1, r2 );
+  r0 = _mm256_add_epi16( r0, r3 );
+  r1 = _mm256_add_epi16( r1, r2 );
+
+  r2 = _mm256_sub_epi16( r0, r1 );
+  r3 = _mm256_sub_epi16( r4, r5 );
+  r0 = _mm256_add_epi16( r0, r1 );
+  r5 = _mm256_add_epi16( r5, r4 );
+
+  // abs
+  __m256i Sum = _mm256_abs_epi16( r0 );
+  Sum = _mm256_add_epi16( Sum, _mm256_abs_epi16( r2 ) );
+  Sum = _mm256_add_epi16( Sum, _mm256_abs_epi16( r3 ) );
+  Sum = _mm256_add_epi16( Sum, _mm256_abs_epi16( r5 ) );
+
+  Sum = _mm256_unpacklo_epi16( Sum, _mm256_setzero_si256() );
+  Sum = _mm256_hadd_epi32( Sum, Sum );
+  Sum = _mm256_hadd_epi32( Sum, Sum );
+
+  sad  = ( ( uint32_t ) _mm_cvtsi128_si32( _mm256_castsi256_si128( Sum ) ) + 1 ) >> 1;
+  sad += ( ( uint32_t ) _mm_cvtsi128_si32( _mm256_extracti128_si256( Sum, 1 ) ) + 1 ) >> 1;
+
+#endif
+  return ( sad );
+}
+
 template< typename Torg, typename Tcur/*, bool bHorDownsampling*/ >
 static uint32_t xCalcHAD16x8_AVX2( const Torg *piOrg, const Tcur *piCur, const int iStrideOrg, const int iStrideCur, const int iBitDepth )
 {
@@ -2249,6 +2738,307 @@ static uint32_t xCalcHAD8x16_AVX2( const Torg *piOrg, const Tcur *piCur, const i
 }
 
 
+/** Two horizontally adjacent 8x4 Hadamard tiles (a 16x4 area), one tile per 128-bit lane.
+ *  Returns the sum of the two tiles, each normalised like xCalcHAD8x4_SSE.
+ */
+template< typename Torg, typename Tcur/*, bool bHorDownsampling*/ >
+static uint32_t xCalcHAD8x4x2_AVX2( const Torg *piOrg, const Tcur *piCur, const int iStrideOrg, const int iStrideCur, const int iBitDepth )
+{
+  uint32_t sad = 0;
+
+#ifdef USE_AVX2
+  __m256i m1[8], m2[8];
+  __m256i vzero = _mm256_setzero_si256();
+
+  for( int k = 0; k < 4; k++ )
+  {
+    __m256i r0 = (sizeof( Torg ) > 1) ? (_mm256_loadu_si256( (__m256i*)piOrg )) : (_mm256_cvtepu8_epi16( _mm_loadu_si128( (const __m128i*)piOrg ) ));
+    __m256i r1 = (sizeof( Tcur ) > 1) ? (_mm256_lddqu_si256( (__m256i*)piCur )) : (_mm256_cvtepu8_epi16( _mm_loadu_si128( (const __m128i*)piCur ) ));
+    m1[k] = _mm256_sub_epi16( r0, r1 );
+    piCur += iStrideCur;
+    piOrg += iStrideOrg;
+  }
+
+  //vertical
+  m2[0] = _mm256_add_epi16( m1[0], m1[2] );
+  m2[1] = _mm256_add_epi16( m1[1], m1[3] );
+  m2[2] = _mm256_sub_epi16( m1[0], m1[2] );
+  m2[3] = _mm256_sub_epi16( m1[1], m1[3] );
+
+  m1[0] = _mm256_add_epi16( m2[0], m2[1] );
+  m1[1] = _mm256_sub_epi16( m2[0], m2[1] );
+  m1[2] = _mm256_add_epi16( m2[2], m2[3] );
+  m1[3] = _mm256_sub_epi16( m2[2], m2[3] );
+
+  // transpose, partially
+  {
+    m2[0] = _mm256_unpacklo_epi16( m1[0], m1[1] );
+    m2[1] = _mm256_unpacklo_epi16( m1[2], m1[3] );
+    m2[2] = _mm256_unpackhi_epi16( m1[0], m1[1] );
+    m2[3] = _mm256_unpackhi_epi16( m1[2], m1[3] );
+
+    m1[0] = _mm256_unpacklo_epi32( m2[0], m2[1] );
+    m1[1] = _mm256_unpackhi_epi32( m2[0], m2[1] );
+    m1[2] = _mm256_unpacklo_epi32( m2[2], m2[3] );
+    m1[3] = _mm256_unpackhi_epi32( m2[2], m2[3] );
+  }
+
+  // horizontal
+  if( iBitDepth >= 10 /*sizeof( Torg ) > 1 || sizeof( Tcur ) > 1*/ )
+  {
+    // finish transpose
+    m2[0] = _mm256_unpacklo_epi64( m1[0], vzero );
+    m2[1] = _mm256_unpackhi_epi64( m1[0], vzero );
+    m2[2] = _mm256_unpacklo_epi64( m1[1], vzero );
+    m2[3] = _mm256_unpackhi_epi64( m1[1], vzero );
+    m2[4] = _mm256_unpacklo_epi64( m1[2], vzero );
+    m2[5] = _mm256_unpackhi_epi64( m1[2], vzero );
+    m2[6] = _mm256_unpacklo_epi64( m1[3], vzero );
+    m2[7] = _mm256_unpackhi_epi64( m1[3], vzero );
+
+    // sign extend the lower four words of each lane
+    for( int i = 0; i < 8; i++ )
+    {
+      m2[i] = _mm256_srai_epi32( _mm256_unpacklo_epi16( m2[i], m2[i] ), 16 );
+    }
+
+    m1[0] = _mm256_add_epi32( m2[0], m2[4] );
+    m1[1] = _mm256_add_epi32( m2[1], m2[5] );
+    m1[2] = _mm256_add_epi32( m2[2], m2[6] );
+    m1[3] = _mm256_add_epi32( m2[3], m2[7] );
+    m1[4] = _mm256_sub_epi32( m2[0], m2[4] );
+    m1[5] = _mm256_sub_epi32( m2[1], m2[5] );
+    m1[6] = _mm256_sub_epi32( m2[2], m2[6] );
+    m1[7] = _mm256_sub_epi32( m2[3], m2[7] );
+
+    m2[0] = _mm256_add_epi32( m1[0], m1[2] );
+    m2[1] = _mm256_add_epi32( m1[1], m1[3] );
+    m2[2] = _mm256_sub_epi32( m1[0], m1[2] );
+    m2[3] = _mm256_sub_epi32( m1[1], m1[3] );
+    m2[4] = _mm256_add_epi32( m1[4], m1[6] );
+    m2[5] = _mm256_add_epi32( m1[5], m1[7] );
+    m2[6] = _mm256_sub_epi32( m1[4], m1[6] );
+    m2[7] = _mm256_sub_epi32( m1[5], m1[7] );
+
+    m1[0] = _mm256_abs_epi32( _mm256_add_epi32( m2[0], m2[1] ) );
+    m1[1] = _mm256_abs_epi32( _mm256_sub_epi32( m2[0], m2[1] ) );
+    m1[2] = _mm256_abs_epi32( _mm256_add_epi32( m2[2], m2[3] ) );
+    m1[3] = _mm256_abs_epi32( _mm256_sub_epi32( m2[2], m2[3] ) );
+    m1[4] = _mm256_abs_epi32( _mm256_add_epi32( m2[4], m2[5] ) );
+    m1[5] = _mm256_abs_epi32( _mm256_sub_epi32( m2[4], m2[5] ) );
+    m1[6] = _mm256_abs_epi32( _mm256_add_epi32( m2[6], m2[7] ) );
+    m1[7] = _mm256_abs_epi32( _mm256_sub_epi32( m2[6], m2[7] ) );
+  }
+  else
+  {
+    m2[0] = _mm256_add_epi16( m1[0], m1[2] );
+    m2[1] = _mm256_add_epi16( m1[1], m1[3] );
+    m2[2] = _mm256_sub_epi16( m1[0], m1[2] );
+    m2[3] = _mm256_sub_epi16( m1[1], m1[3] );
+
+    m1[0] = _mm256_add_epi16( m2[0], m2[1] );
+    m1[1] = _mm256_sub_epi16( m2[0], m2[1] );
+    m1[2] = _mm256_add_epi16( m2[2], m2[3] );
+    m1[3] = _mm256_sub_epi16( m2[2], m2[3] );
+
+    // finish transpose
+    m2[0] = _mm256_unpacklo_epi64( m1[0], vzero );
+    m2[1] = _mm256_unpackhi_epi64( m1[0], vzero );
+    m2[2] = _mm256_unpacklo_epi64( m1[1], vzero );
+    m2[3] = _mm256_unpackhi_epi64( m1[1], vzero );
+    m2[4] = _mm256_unpacklo_epi64( m1[2], vzero );
+    m2[5] = _mm256_unpackhi_epi64( m1[2], vzero );
+    m2[6] = _mm256_unpacklo_epi64( m1[3], vzero );
+    m2[7] = _mm256_unpackhi_epi64( m1[3], vzero );
+
+    m1[0] = _mm256_abs_epi16( _mm256_add_epi16( m2[0], m2[1] ) );
+    m1[1] = _mm256_abs_epi16( _mm256_sub_epi16( m2[0], m2[1] ) );
+    m1[2] = _mm256_abs_epi16( _mm256_add_epi16( m2[2], m2[3] ) );
+    m1[3] = _mm256_abs_epi16( _mm256_sub_epi16( m2[2], m2[3] ) );
+    m1[4] = _mm256_abs_epi16( _mm256_add_epi16( m2[4], m2[5] ) );
+    m1[5] = _mm256_abs_epi16( _mm256_sub_epi16( m2[4], m2[5] ) );
+    m1[6] = _mm256_abs_epi16( _mm256_add_epi16( m2[6], m2[7] ) );
+    m1[7] = _mm256_abs_epi16( _mm256_sub_epi16( m2[6], m2[7] ) );
+
+    for( int i = 0; i < 8; i++ )
+    {
+      m1[i] = _mm256_unpacklo_epi16( m1[i], vzero );
+    }
+  }
+
+  m1[0] = _mm256_add_epi32( m1[0], m1[1] );
+  m1[1] = _mm256_add_epi32( m1[2], m1[3] );
+  m1[2] = _mm256_add_epi32( m1[4], m1[5] );
+  m1[3] = _mm256_add_epi32( m1[6], m1[7] );
+
+  m1[0] = _mm256_add_epi32( m1[0], m1[1] );
+  m1[1] = _mm256_add_epi32( m1[2], m1[3] );
+
+  __m256i iSum = _mm256_add_epi32( m1[0], m1[1] );
+
+  iSum = _mm256_hadd_epi32( iSum, iSum );
+  iSum = _mm256_hadd_epi32( iSum, iSum );
+
+  // the tiles are normalised separately to match the 8x4 kernel
+  uint32_t sad0 = _mm_cvtsi128_si32( _mm256_castsi256_si128( iSum ) );
+  uint32_t sad1 = _mm_cvtsi128_si32( _mm256_extracti128_si256( iSum, 1 ) );
+  sad  = (uint32_t)(sad0 / sqrt(4.0 * 8) * 2);
+  sad += (uint32_t)(sad1 / sqrt(4.0 * 8) * 2);
+
+#endif //USE_AVX2
+
+  return (sad);
+}
+
+
+/** Two vertically adjacent 4x8 Hadamard tiles (a 4x16 area), one tile per 128-bit lane.
+ *  Returns the sum of the two tiles, each normalised like xCalcHAD4x8_SSE.
+ */
+template< typename Torg, typename Tcur/*, bool bHorDownsampling*/ >
+static uint32_t xCalcHAD4x8x2_AVX2( const Torg *piOrg, const Tcur *piCur, const int iStrideOrg, const int iStrideCur, const int iBitDepth )
+{
+  uint32_t sad = 0;
+
+#ifdef USE_AVX2
+  __m256i m1[8], m2[8];
+
+  const Torg *piOrg2 = piOrg + 8 * iStrideOrg;
+  const Tcur *piCur2 = piCur + 8 * iStrideCur;
+
+  for( int k = 0; k < 8; k++ )
+  {
+    __m128i r0 = (sizeof( Torg ) > 1) ? (_mm_loadl_epi64( (__m128i*)piOrg  )) : (_mm_cvtepu8_epi16( _mm_cvtsi32_si128( *(const int*)piOrg  ) ));
+    __m128i r1 = (sizeof( Tcur ) > 1) ? (_mm_loadl_epi64( (__m128i*)piCur  )) : (_mm_cvtepu8_epi16( _mm_cvtsi32_si128( *(const int*)piCur  ) ));
+    __m128i r2 = (sizeof( Torg ) > 1) ? (_mm_loadl_epi64( (__m128i*)piOrg2 )) : (_mm_cvtepu8_epi16( _mm_cvtsi32_si128( *(const int*)piOrg2 ) ));
+    __m128i r3 = (sizeof( Tcur ) > 1) ? (_mm_loadl_epi64( (__m128i*)piCur2 )) : (_mm_cvtepu8_epi16( _mm_cvtsi32_si128( *(const int*)piCur2 ) ));
+    m2[k] = _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_sub_epi16( r0, r1 ) ), _mm_sub_epi16( r2, r3 ), 1 );
+    piCur  += iStrideCur;
+    piOrg  += iStrideOrg;
+    piCur2 += iStrideCur;
+    piOrg2 += iStrideOrg;
+  }
+
+  // vertical
+
+  m1[0] = _mm256_add_epi16( m2[0], m2[4] );
+  m1[1] = _mm256_add_epi16( m2[1], m2[5] );
+  m1[2] = _mm256_add_epi16( m2[2], m2[6] );
+  m1[3] = _mm256_add_epi16( m2[3], m2[7] );
+  m1[4] = _mm256_sub_epi16( m2[0], m2[4] );
+  m1[5] = _mm256_sub_epi16( m2[1], m2[5] );
+  m1[6] = _mm256_sub_epi16( m2[2], m2[6] );
+  m1[7] = _mm256_sub_epi16( m2[3], m2[7] );
+
+  m2[0] = _mm256_add_epi16( m1[0], m1[2] );
+  m2[1] = _mm256_add_epi16( m1[1], m1[3] );
+  m2[2] = _mm256_sub_epi16( m1[0], m1[2] );
+  m2[3] = _mm256_sub_epi16( m1[1], m1[3] );
+  m2[4] = _mm256_add_epi16( m1[4], m1[6] );
+  m2[5] = _mm256_add_epi16( m1[5], m1[7] );
+  m2[6] = _mm256_sub_epi16( m1[4], m1[6] );
+  m2[7] = _mm256_sub_epi16( m1[5], m1[7] );
+
+  m1[0] = _mm256_add_epi16( m2[0], m2[1] );
+  m1[1] = _mm256_sub_epi16( m2[0], m2[1] );
+  m1[2] = _mm256_add_epi16( m2[2], m2[3] );
+  m1[3] = _mm256_sub_epi16( m2[2], m2[3] );
+  m1[4] = _mm256_add_epi16( m2[4], m2[5] );
+  m1[5] = _mm256_sub_epi16( m2[4], m2[5] );
+  m1[6] = _mm256_add_epi16( m2[6], m2[7] );
+  m1[7] = _mm256_sub_epi16( m2[6], m2[7] );
+
+
+  // horizontal
+  // transpose
+  {
+    m2[0] = _mm256_unpacklo_epi16( m1[0], m1[1] );
+    m2[1] = _mm256_unpacklo_epi16( m1[2], m1[3] );
+    m2[2] = _mm256_unpacklo_epi16( m1[4], m1[5] );
+    m2[3] = _mm256_unpacklo_epi16( m1[6], m1[7] );
+
+    m1[0] = _mm256_unpacklo_epi32( m2[0], m2[1] );
+    m1[1] = _mm256_unpackhi_epi32( m2[0], m2[1] );
+    m1[2] = _mm256_unpacklo_epi32( m2[2], m2[3] );
+    m1[3] = _mm256_unpackhi_epi32( m2[2], m2[3] );
+
+    m2[0] = _mm256_unpacklo_epi64( m1[0], m1[2] );
+    m2[1] = _mm256_unpackhi_epi64( m1[0], m1[2] );
+    m2[2] = _mm256_unpacklo_epi64( m1[1], m1[3] );
+    m2[3] = _mm256_unpackhi_epi64( m1[1], m1[3] );
+  }
+
+  if( iBitDepth >= 10 /*sizeof( Torg ) > 1 || sizeof( Tcur ) > 1*/ )
+  {
+    __m256i n1[4][2];
+    __m256i n2[4][2];
+
+    // sign extend the lower and the upper four words of each lane
+    for( int i = 0; i < 4; i++ )
+    {
+      n1[i][0] = _mm256_srai_epi32( _mm256_unpacklo_epi16( m2[i], m2[i] ), 16 );
+      n1[i][1] = _mm256_srai_epi32( _mm256_unpackhi_epi16( m2[i], m2[i] ), 16 );
+    }
+
+    for( int i = 0; i < 2; i++ )
+    {
+      n2[0][i] = _mm256_add_epi32( n1[0][i], n1[2][i] );
+      n2[1][i] = _mm256_add_epi32( n1[1][i], n1[3][i] );
+      n2[2][i] = _mm256_sub_epi32( n1[0][i], n1[2][i] );
+      n2[3][i] = _mm256_sub_epi32( n1[1][i], n1[3][i] );
+
+      n1[0][i] = _mm256_abs_epi32( _mm256_add_epi32( n2[0][i], n2[1][i] ) );
+      n1[1][i] = _mm256_abs_epi32( _mm256_sub_epi32( n2[0][i], n2[1][i] ) );
+      n1[2][i] = _mm256_abs_epi32( _mm256_add_epi32( n2[2][i], n2[3][i] ) );
+      n1[3][i] = _mm256_abs_epi32( _mm256_sub_epi32( n2[2][i], n2[3][i] ) );
+    }
+    for( int i = 0; i < 4; i++ )
+    {
+      m1[i] = _mm256_add_epi32( n1[i][0], n1[i][1] );
+    }
+  }
+  else
+  {
+    m1[0] = _mm256_add_epi16( m2[0], m2[2] );
+    m1[1] = _mm256_add_epi16( m2[1], m2[3] );
+    m1[2] = _mm256_sub_epi16( m2[0], m2[2] );
+    m1[3] = _mm256_sub_epi16( m2[1], m2[3] );
+
+    m2[0] = _mm256_abs_epi16( _mm256_add_epi16( m1[0], m1[1] ) );
+    m2[1] = _mm256_abs_epi16( _mm256_sub_epi16( m1[0], m1[1] ) );
+    m2[2] = _mm256_abs_epi16( _mm256_add_epi16( m1[2], m1[3] ) );
+    m2[3] = _mm256_abs_epi16( _mm256_sub_epi16( m1[2], m1[3] ) );
+
+    __m256i ma1, ma2;
+    __m256i vzero = _mm256_setzero_si256();
+
+    for( int i = 0; i < 4; i++ )
+    {
+      ma1 = _mm256_unpacklo_epi16( m2[i], vzero );
+      ma2 = _mm256_unpackhi_epi16( m2[i], vzero );
+      m1[i] = _mm256_add_epi32( ma1, ma2 );
+    }
+  }
+
+  m1[0] = _mm256_add_epi32( m1[0], m1[1] );
+  m1[2] = _mm256_add_epi32( m1[2], m1[3] );
+
+  __m256i iSum = _mm256_add_epi32( m1[0], m1[2] );
+
+  iSum = _mm256_hadd_epi32( iSum, iSum );
+  iSum = _mm256_hadd_epi32( iSum, iSum );
+
+  // the tiles are normalised separately to match the 4x8 kernel
+  uint32_t sad0 = _mm_cvtsi128_si32( _mm256_castsi256_si128( iSum ) );
+  uint32_t sad1 = _mm_cvtsi128_si32( _mm256_extracti128_si256( iSum, 1 ) );
+  sad  = (uint32_t)(sad0 / sqrt(4.0 * 8) * 2);
+  sad += (uint32_t)(sad1 / sqrt(4.0 * 8) * 2);
+
+#endif //USE_AVX2
+
+  return (sad);
+}
+
+
 template< typename Torg, typename Tcur, X86_VEXT vext >
 Distortion RdCost::xGetHADs_SIMD( const DistParam &rcDtParam )
 {
@@ -2302,7 +3092,15 @@ Distortion RdCost::xGetHADs_SIMD( const DistParam &rcDtParam )
   {
     for( y = 0; y < iRows; y += 4 )
     {
-      for( x = 0; x < iCols; x += 8 )
+      x = 0;
+      if( vext >= AVX2 )
+      {
+        for( ; x + 16 <= iCols; x += 16 )
+        {
+          uiSum += xCalcHAD8x4x2_AVX2<Torg, Tcur>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur, iBitDepth );
+        }
+      }
+      for( ; x < iCols; x += 8 )
       {
         uiSum += xCalcHAD8x4_SSE<Torg, Tcur>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur, iBitDepth );
       }
@@ -2312,7 +3110,20 @@ Distortion RdCost::xGetHADs_SIMD( const DistParam &rcDtParam )
   }
   else if( rcDtParam.isQtbt && iCols < iRows && ( iRows & 7 ) == 0 && ( iCols & 3 ) == 0 )
   {
-    for( y = 0; y < iRows; y += 8 )
+    y = 0;
+    if( vext >= AVX2 )
+    {
+      for( ; y + 16 <= iRows; y += 16 )
+      {
+        for( x = 0; x < iCols; x += 4 )
+        {
+          uiSum += xCalcHAD4x8x2_AVX2<Torg, Tcur>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur, iBitDepth );
+        }
+        piOrg += iStrideOrg * 16;
+        piCur += iStrideCur * 16;
+      }
+    }
+    for( ; y < iRows; y += 8 )
     {
       for( x = 0; x < iCols; x += 4 )
       {
@@ -2330,7 +3141,10 @@ Distortion RdCost::xGetHADs_SIMD( const DistParam &rcDtParam )
     {
       for( x = 0; x < iCols; x += 16 )
       {
-        uiSum += xCalcHAD16x16_AVX2<Torg, Tcur>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur, iBitDepth );
+        if( vext >= AVX512 && sizeof( Torg ) > 1 && sizeof( Tcur ) > 1 )
+          uiSum += xCalcHAD16x16_AVX512<Torg, Tcur>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur, iBitDepth );
+        else
+          uiSum += xCalcHAD16x16_AVX2<Torg, Tcur>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur, iBitDepth );
       }
       piOrg += iOffsetOrg;
       piCur += iOffsetCur;
@@ -2342,7 +3156,16 @@ Distortion RdCost::xGetHADs_SIMD( const DistParam &rcDtParam )
     int  iOffsetCur = iStrideCur << 3;
     for( y = 0; y<iRows; y += 8 )
     {
-      for( x = 0; x < iCols; x += 8 )
+      x = 0;
+      if( vext >= AVX2 )
+      {
+        // a QTBT block only gets here as a single 8x8 tile, the pairs come from the blocks of the other partitionings
+        for( ; x + 16 <= iCols; x += 16 )
+        {
+          uiSum += xCalcHAD8x8x2_AVX2<Torg, Tcur>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur, iBitDepth );
+        }
+      }
+      for( ; x < iCols; x += 8 )
       {
         uiSum += xCalcHAD8x8_SSE<Torg, Tcur>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur, iBitDepth );
       }
@@ -2357,7 +3180,16 @@ Distortion RdCost::xGetHADs_SIMD( const DistParam &rcDtParam )
 
     for( y = 0; y < iRows; y += 4 )
     {
-      for( x = 0; x < iCols; x += 4 )
+      x = 0;
+      if( vext >= AVX2 )
+      {
+        // as for the 8x8 tiles, a QTBT block only gets here as a single 4x4 tile
+        for( ; x + 8 <= iCols; x += 8 )
+        {
+          uiSum += xCalcHAD4x4x2_AVX2<Torg, Tcur>( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur );
+        }
+      }
+      for( ; x < iCols; x += 4 )
       {
         uiSum += xCalcHAD4x4_SSE( &piOrg[x], &piCur[x], iStrideOrg, iStrideCur );
       }
@@ -2400,6 +3232,20 @@ void RdCost::_initRdCostX86()
   //m_afpDistortFunc[DF_SSE32  ] = xGetSSE_NxN_SIMD<Pel, Pel, 32, vext>;
   //m_afpDistortFunc[DF_SSE64  ] = xGetSSE_NxN_SIMD<Pel, Pel, 64, vext>;
   //m_afpDistortFunc[DF_SSE16N ] = xGetSSE_SIMD<Pel, Pel, vext>;
+#if FULL_NBIT
+  if( vext >= AVX512 )
+  {
+    // without a distortion shift the 64 bit sums of the AVX-512 kernel equal the scalar result
+    m_afpDistortFunc[DF_SSE    ] = xGetSSE_SIMD<Pel, Pel, vext>;
+    m_afpDistortFunc[DF_SSE2   ] = xGetSSE_SIMD<Pel, Pel, vext>;
+    m_afpDistortFunc[DF_SSE4   ] = xGetSSE_NxN_SIMD<Pel, Pel, 4,  vext>;
+    m_afpDistortFunc[DF_SSE8   ] = xGetSSE_NxN_SIMD<Pel, Pel, 8,  vext>;
+    m_afpDistortFunc[DF_SSE16  ] = xGetSSE_NxN_SIMD<Pel, Pel, 16, vext>;
+    m_afpDistortFunc[DF_SSE32  ] = xGetSSE_NxN_SIMD<Pel, Pel, 32, vext>;
+    m_afpDistortFunc[DF_SSE64  ] = xGetSSE_NxN_SIMD<Pel, Pel, 64, vext>;
+    m_afpDistortFunc[DF_SSE16N ] = xGetSSE_SIMD<Pel, Pel, vext>;
+  }
+#endif
 
   m_afpDistortFunc[DF_SAD    ] = xGetSAD_SIMD<vext>;
   m_afpDistortFunc[DF_SAD2   ] = xGetSAD_SIMD<vext>;
@@ -2414,6 +3260,8 @@ void RdCost::_initRdCostX86()
   m_afpDistortFunc[DF_SAD24  ] = RdCost::xGetSAD_SIMD<vext>;
   m_afpDistortFunc[DF_SAD48  ] = RdCost::xGetSAD_SIMD<vext>;
 
+  m_fpSADx4                     = RdCost::xGetSADx4_SIMD<vext>;
+
   m_afpDistortFunc[DF_HAD]     = RdCost::xGetHADs_SIMD<Pel, Pel, vext>;
   m_afpDistortFunc[DF_HAD2]    = RdCost::xGetHADs_SIMD<Pel, Pel, vext>;
   m_afpDistortFunc[DF_HAD4]    = RdCost::xGetHADs_SIMD<Pel, Pel, vext>;
@@ -1878,7 +1878,7 @@ void CABACReader::residual_coding( TransformUnit& tu, ComponentID compID )
 #else
   CoeffCodingContext  cctx    ( tu, compID );
 #endif
-  TCoeff*             coeff   = tu.getCoeffs( compID ).buf;
+  TCoeffLevel*        coeff   = tu.getCoeffs( compID ).buf;
   unsigned            numSig  = 0;
 
   // parse last coeff position
@@ -2120,7 +2120,7 @@ int CABACReader::last_sig_coeff( CoeffCodingContext& cctx )
 
 
 
-void CABACReader::residual_coding_subblock( CoeffCodingContext& cctx, TCoeff* coeff, const int stateTransTable, int& state )
+void CABACReader::residual_coding_subblock( CoeffCodingContext& cctx, TCoeffLevel* coeff, const int stateTransTable, int& state )
 {
   // NOTE: All coefficients of the subblock must be set to zero before calling this function
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
@@ -2208,7 +2208,7 @@ void CABACReader::residual_coding_subblock( CoeffCodingContext& cctx, TCoeff* co
     nextPass = 0;
     for( int scanPos = firstSigPos; scanPos >= minSubPos; scanPos-- )
     {
-      TCoeff& tcoeff = coeff[ cctx.blockPos( scanPos ) ];
+      TCoeffLevel& tcoeff = coeff[ cctx.blockPos( scanPos ) ];
       if( tcoeff > 2 )
       {
         RExt__DECODER_DEBUG_BIT_STATISTICS_SET( ctype_gt2 );
@@ -2226,7 +2226,7 @@ void CABACReader::residual_coding_subblock( CoeffCodingContext& cctx, TCoeff* co
   {
     for( int scanPos = firstSigPos; scanPos >= minSubPos; scanPos-- )
     {
-      TCoeff& tcoeff = coeff[ cctx.blockPos( scanPos ) ];
+      TCoeffLevel& tcoeff = coeff[ cctx.blockPos( scanPos ) ];
       if( tcoeff > 4 )
       {
         RExt__DECODER_DEBUG_BIT_STATISTICS_SET( ctype_escs );
@@ -131,7 +131,7 @@ public:
   void        emt_cu_flag               ( CodingUnit&                   cu );
   void        explicit_rdpcm_mode       ( TransformUnit&                tu,     ComponentID     compID );
   int         last_sig_coeff            ( CoeffCodingContext&           cctx );
-  void        residual_coding_subblock  ( CoeffCodingContext&           cctx,   TCoeff*         coeff, const int stateTransTable, int& state );
+  void        residual_coding_subblock  ( CoeffCodingContext&           cctx,   TCoeffLevel*    coeff, const int stateTransTable, int& state );
 
   // cross component prediction (clause 7.3.8.12)
   void        cross_comp_pred           ( TransformUnit&                tu,     ComponentID     compID );
@@ -368,6 +368,7 @@ DecLib::DecLib()
   , m_pDecodedSEIOutputStream(NULL)
   , m_decodedPictureHashSEIEnabled(false)
   , m_numberOfChecksumErrorsDetected(0)
+  , m_extendRefPicBorder(false)
   , m_warningMessageSkipPicture(false)
   , m_prefixSEINALUs()
 {
@@ -416,6 +417,8 @@ void DecLib::init(
 
 void DecLib::deletePicBuffer ( )
 {
+  Picture::reportBufferMemory();
+
   PicList::iterator  iterPic   = m_cListPic.begin();
   int iSize = int( m_cListPic.size() );
 
@@ -427,6 +430,7 @@ void DecLib::deletePicBuffer ( )
     delete pcPic;
     pcPic = NULL;
   }
+  g_picBufferPool.trim();
   m_cALF.destroy();
   m_cSAO.destroy();
   m_cLoopFilter.destroy();
@@ -488,10 +492,14 @@ Picture* DecLib::xGetNewPicBuffer ( const SPS &sps, const PPS &pps, const uint32
     {
       pcPic->destroy();
       pcPic->create( sps.getChromaFormatIdc(), Size( sps.getPicWidthInLumaSamples(), sps.getPicHeightInLumaSamples() ), sps.getMaxCUWidth(), sps.getMaxCUWidth() + 16, true );
+
+      // planes of the old format are not needed anymore
+      g_picBufferPool.trim();
     }
   }
 
   pcPic->setBorderExtension( false );
+  pcPic->setSkipBorderExtension( !m_extendRefPicBorder );
   pcPic->neededForOutput = false;
   pcPic->reconstructed = false;
 
@@ -595,6 +603,9 @@ void DecLib::finishPicture(int& poc, PicList*& rpcListPic, MsgLevel msgl )
   m_pcPic->destroyTempBuffers();
   m_pcPic->cs->destroyCoeffs();
   m_pcPic->cs->releaseIntermediateData();
+  // later pictures only read the motion of this one through the temporal motion vector prediction,
+  // not done in executeLoopFilters() as the debug bitstream path of the encoder copies the full motion field after it
+  m_pcPic->cs->compressMotion();
 }
 
 void DecLib::checkNoOutputPriorPics (PicList* pcListPic)
@@ -118,6 +118,7 @@ private:
 
   int                     m_decodedPictureHashSEIEnabled;  ///< Checksum(3)/CRC(2)/MD5(1)/disable(0) acting on decoded picture hash SEI message
   uint32_t                    m_numberOfChecksumErrorsDetected;
+  bool                    m_extendRefPicBorder;            ///< pad the reference picture borders instead of clamping the motion compensation fetches
 
   bool                    m_warningMessageSkipPicture;
 
@@ -130,6 +131,7 @@ public:
   void  destroy ();
 
   void  setDecodedPictureHashSEIEnabled(int enabled) { m_decodedPictureHashSEIEnabled=enabled; }
+  void  setExtendRefPicBorder(bool b)                { m_extendRefPicBorder = b; }
 
   void  init(
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
@@ -1804,7 +1804,7 @@ void CABACWriter::residual_coding( const TransformUnit& tu, ComponentID compID )
 #else
   CoeffCodingContext  cctx    ( tu, compID );
 #endif
-  const TCoeff*       coeff   = tu.getCoeffs( compID ).buf;
+  const TCoeffLevel*  coeff   = tu.getCoeffs( compID ).buf;
   unsigned            numSig  = 0;
 
   // determine and set last coeff position and sig group flags
@@ -2034,7 +2034,7 @@ void CABACWriter::last_sig_coeff( CoeffCodingContext& cctx )
 
 
 
-void CABACWriter::residual_coding_subblock( CoeffCodingContext& cctx, const TCoeff* coeff, const int stateTransTable, int& state )
+void CABACWriter::residual_coding_subblock( CoeffCodingContext& cctx, const TCoeffLevel* coeff, const int stateTransTable, int& state )
 {
   //===== init =====
   const int   minSubPos   = cctx.minSubPos();
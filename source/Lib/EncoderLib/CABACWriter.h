@@ -145,7 +145,7 @@ public:
   void        emt_cu_flag               ( const CodingUnit&             cu );
   void        explicit_rdpcm_mode       ( const TransformUnit&          tu,       ComponentID       compID );
   void        last_sig_coeff            ( CoeffCodingContext&           cctx );
-  void        residual_coding_subblock  ( CoeffCodingContext&           cctx,     const TCoeff*     coeff, const int stateTransTable, int& state   );
+  void        residual_coding_subblock  ( CoeffCodingContext&           cctx,     const TCoeffLevel* coeff, const int stateTransTable, int& state   );
 
   // cross component prediction (clause 7.3.8.12)
   void        cross_comp_pred           ( const TransformUnit&          tu,       ComponentID       compID );
@@ -208,10 +208,15 @@ protected:
 
   bool      m_useFastLCTU;
   bool      m_useFastMrg;
+  bool      m_mergePredCache;
+  bool      m_mergeSatdSkip;
   bool      m_usePbIntraFast;
   bool      m_useAMaxBT;
   bool      m_e0023FastEnc;
   bool      m_contentBasedFastQtbt;
+  bool      m_splitPredictor;
+  int       m_splitPredictorThreshold;
+  std::string m_splitPredictorDumpFile;
 
   //======= Transform =============
   uint32_t      m_uiQuadtreeTULog2MaxSize;
@@ -246,6 +251,9 @@ protected:
   int       m_bipredSearchRange;
   bool      m_bClipForBiPredMeEnabled;
   bool      m_bFastMEAssumingSmootherMVEnabled;
+  bool      m_temporalMvSeeds;
+  bool      m_globalMotionEstimation;
+  int       m_refSubPelCache;
   int       m_minSearchWindow;
   bool      m_bRestrictMESampling;
 
@@ -310,9 +318,11 @@ protected:
   int*      m_aidQP;
   uint32_t      m_uiDeltaQpRD;
   bool      m_bFastDeltaQP;
+  bool      m_crossQpReuse;
 
   bool      m_bUseConstrainedIntraPred;
   bool      m_bFastUDIUseMPMEnabled;
+  bool      m_intraSatdCache;
   bool      m_bFastMEForGenBLowDelayEnabled;
   bool      m_bUseBLambdaForNonKeyLowDelayPictures;
   bool      m_usePCM;
@@ -656,6 +666,10 @@ public:
   bool      getUseFastLCTU                  () const         { return m_useFastLCTU; }
   void      setUseFastMerge                 ( bool  n )      { m_useFastMrg = n; }
   bool      getUseFastMerge                 () const         { return m_useFastMrg; }
+  void      setUseMergePredCache            ( bool  b )      { m_mergePredCache = b; }
+  bool      getUseMergePredCache            () const         { return m_mergePredCache; }
+  void      setUseMergeSatdSkip             ( bool  b )      { m_mergeSatdSkip = b; }
+  bool      getUseMergeSatdSkip             () const         { return m_mergeSatdSkip; }
   void      setUsePbIntraFast               ( bool  n )      { m_usePbIntraFast = n; }
   bool      getUsePbIntraFast               () const         { return m_usePbIntraFast; }
   void      setUseAMaxBT                    ( bool  n )      { m_useAMaxBT = n; }
@@ -665,6 +679,12 @@ public:
   bool      getUseE0023FastEnc              () const         { return m_e0023FastEnc; }
   void      setUseContentBasedFastQtbt      ( bool b )       { m_contentBasedFastQtbt = b; }
   bool      getUseContentBasedFastQtbt      () const         { return m_contentBasedFastQtbt; }
+  void      setUseSplitPredictor            ( bool b )       { m_splitPredictor = b; }
+  bool      getUseSplitPredictor            () const         { return m_splitPredictor; }
+  void      setSplitPredictorThreshold      ( int  i )       { m_splitPredictorThreshold = i; }
+  int       getSplitPredictorThreshold      () const         { return m_splitPredictorThreshold; }
+  void      setSplitPredictorDumpFile       ( const std::string& s ) { m_splitPredictorDumpFile = s; }
+  const std::string& getSplitPredictorDumpFile() const       { return m_splitPredictorDumpFile; }
 
   //======== Transform =============
   void      setQuadtreeTULog2MaxSize        ( uint32_t  u )      { m_uiQuadtreeTULog2MaxSize = u; }
@@ -691,6 +711,9 @@ public:
   void      setBipredSearchRange            ( int   i )      { m_bipredSearchRange = i; }
   void      setClipForBiPredMeEnabled       ( bool  b )      { m_bClipForBiPredMeEnabled = b; }
   void      setFastMEAssumingSmootherMVEnabled ( bool b )    { m_bFastMEAssumingSmootherMVEnabled = b; }
+  void      setUseTemporalMvSeeds           ( bool b )    { m_temporalMvSeeds = b; }
+  void      setUseGlobalMotionEstimation    ( bool b )    { m_globalMotionEstimation = b; }
+  void      setRefSubPelCache               ( int  i )    { m_refSubPelCache = i; }
   void      setMinSearchWindow              ( int   i )      { m_minSearchWindow = i; }
   void      setRestrictMESampling           ( bool  b )      { m_bRestrictMESampling = b; }
 
@@ -806,6 +829,9 @@ public:
   int       getSearchRange                     () const { return m_iSearchRange; }
   bool      getClipForBiPredMeEnabled          () const { return m_bClipForBiPredMeEnabled; }
   bool      getFastMEAssumingSmootherMVEnabled () const { return m_bFastMEAssumingSmootherMVEnabled; }
+  bool      getUseTemporalMvSeeds           () const { return m_temporalMvSeeds; }
+  bool      getUseGlobalMotionEstimation    () const { return m_globalMotionEstimation; }
+  int       getRefSubPelCache               () const { return m_refSubPelCache; }
   int       getMinSearchWindow                 () const { return m_minSearchWindow; }
   bool      getRestrictMESampling              () const { return m_bRestrictMESampling; }
 
@@ -837,6 +863,7 @@ public:
   void      setUseEarlySkipDetection        ( bool  b )     { m_useEarlySkipDetection = b; }
   void      setUseConstrainedIntraPred      ( bool  b )     { m_bUseConstrainedIntraPred = b; }
   void      setFastUDIUseMPMEnabled         ( bool  b )     { m_bFastUDIUseMPMEnabled = b; }
+  void      setUseIntraSatdCache            ( bool  b )     { m_intraSatdCache = b; }
   void      setFastMEForGenBLowDelayEnabled ( bool  b )     { m_bFastMEForGenBLowDelayEnabled = b; }
   void      setUseBLambdaForNonKeyLowDelayPictures ( bool b ) { m_bUseBLambdaForNonKeyLowDelayPictures = b; }
 
@@ -849,6 +876,7 @@ public:
   void      setdQPs                         ( int*  p )     { m_aidQP       = p; }
   void      setDeltaQpRD                    ( uint32_t  u )     {m_uiDeltaQpRD  = u; }
   void      setFastDeltaQp                  ( bool  b )     {m_bFastDeltaQP = b; }
+  void      setUseCrossQpReuse              ( bool  b )     {m_crossQpReuse = b; }
   int       getBitDepth                     (const ChannelType chType) const { return m_bitDepth[chType]; }
   bool      getUseASR                       ()      { return m_bUseASR;     }
   bool      getUseHADME                     ()      { return m_bUseHADME;   }
@@ -865,6 +893,7 @@ public:
   bool      getUseEarlySkipDetection        () const{ return m_useEarlySkipDetection; }
   bool      getUseConstrainedIntraPred      ()      { return m_bUseConstrainedIntraPred; }
   bool      getFastUDIUseMPMEnabled         ()      { return m_bFastUDIUseMPMEnabled; }
+  bool      getUseIntraSatdCache            () const { return m_intraSatdCache; }
   bool      getFastMEForGenBLowDelayEnabled ()      { return m_bFastMEForGenBLowDelayEnabled; }
   bool      getUseBLambdaForNonKeyLowDelayPictures () { return m_bUseBLambdaForNonKeyLowDelayPictures; }
   bool      getPCMInputBitDepthFlag         ()      { return m_bPCMInputBitDepthFlag;   }
@@ -901,6 +930,7 @@ public:
   const int* getdQPs                        () const { return m_aidQP;       }
   uint32_t      getDeltaQpRD                    () const { return m_uiDeltaQpRD; }
   bool      getFastDeltaQp                  () const { return m_bFastDeltaQP; }
+  bool      getUseCrossQpReuse              () const { return m_crossQpReuse; }
 
   //====== Slice ========
   void  setSliceMode                   ( SliceConstraint  i )        { m_sliceMode = i;              }
@@ -156,6 +156,11 @@ void EncCu::create( EncCfg* encCfg )
     m_acMergeBuffer[ui].create( chromaFormat, Area( 0, 0, uiMaxWidth, uiMaxHeight ) );
   }
 
+  if( encCfg->getUseMergePredCache() )
+  {
+    m_mergePredCache.create( chromaFormat, uiMaxWidth, uiMaxHeight );
+  }
+
   m_CtxBuffer.resize( maxDepth );
   m_CurrCtx = 0;
 }
@@ -218,6 +223,8 @@ void EncCu::destroy()
   {
     m_acMergeBuffer[ui].destroy();
   }
+
+  m_mergePredCache.destroy();
 }
 
 
@@ -254,6 +261,12 @@ void EncCu::init( EncLib* pcEncLib, const SPS& sps PARL_PARAM( const int tId ) )
   m_modeCtrl->init( m_pcEncCfg, m_pcRateCtrl, m_pcRdCost );
 
   m_pcInterSearch->setModeCtrl( m_modeCtrl );
+
+  m_crossQpCache.init( m_pcEncCfg->getUseCrossQpReuse() );
+  m_pcInterSearch->setCrossQpCache( m_crossQpCache.isEnabled() ? &m_crossQpCache : nullptr );
+  m_pcInterSearch->setMotionFieldCache( pcEncLib->getMotionFieldCache()->isEnabled() ? pcEncLib->getMotionFieldCache() : nullptr );
+  m_pcInterSearch->setGlobalMotion( pcEncLib->getGlobalMotion()->isEnabled() ? pcEncLib->getGlobalMotion() : nullptr );
+  m_pcInterSearch->setRefSubPelCache( pcEncLib->getRefSubPelCache()->isEnabled() ? pcEncLib->getRefSubPelCache() : nullptr );
   ::memset(m_subMergeBlkSize, 0, sizeof(m_subMergeBlkSize));
   ::memset(m_subMergeBlkNum, 0, sizeof(m_subMergeBlkNum));
   m_prevPOC = MAX_UINT;
@@ -974,8 +987,9 @@ void EncCu::xCheckModeSplit(CodingStructure *&tempCS, CodingStructure *&bestCS,
         return;
       }
 
+      // the picture already holds the reconstruction of the best sub-structure, see the end of xCompressCU
       bool keepResi = KEEP_PRED_AND_RESI_SIGNALS;
-      tempCS->useSubStructure( *bestSubCS, partitioner.chType, CS::getArea( *tempCS, subCUArea, partitioner.chType ), KEEP_PRED_AND_RESI_SIGNALS, true, keepResi, keepResi );
+      tempCS->adoptSubStructure( *bestSubCS, partitioner.chType, CS::getArea( *tempCS, subCUArea, partitioner.chType ), KEEP_PRED_AND_RESI_SIGNALS, keepResi, keepResi );
 
       if(currDepth < pps.getMaxCuDQPDepth())
       {
@@ -1450,6 +1464,7 @@ void EncCu::xCheckRDCostMerge2Nx2N( CodingStructure *&tempCS, CodingStructure *&
     }
 
     static_vector<double, MRG_MAX_NUM_CANDS> candCostList;
+    Distortion                               candSatd[MRG_MAX_NUM_CANDS];
 
     // 1. Pass: get SATD-cost for selected candidates and reduce their count
     if( !bestIsSkip )
@@ -1492,8 +1507,12 @@ void EncCu::xCheckRDCostMerge2Nx2N( CodingStructure *&tempCS, CodingStructure *&
 
         distParam.cur = acMergeBuffer[uiMergeCand].Y();
 
-        m_pcInterSearch->motionCompensation( pu,  acMergeBuffer[uiMergeCand] );
-        
+        if( !m_mergePredCache.getPred( pu, acMergeBuffer[uiMergeCand] ) )
+        {
+          m_pcInterSearch->motionCompensation( pu, acMergeBuffer[uiMergeCand] );
+          m_mergePredCache.setPred( pu, acMergeBuffer[uiMergeCand] );
+        }
+
         if( mergeCtx.interDirNeighbours[uiMergeCand] == 3 && mergeCtx.mrgTypeNeighbours[uiMergeCand] == MRG_TYPE_DEFAULT_N )
         {
           mergeCtx.mvFieldNeighbours[2*uiMergeCand].mv   = pu.mv[0];
@@ -1504,6 +1523,7 @@ void EncCu::xCheckRDCostMerge2Nx2N( CodingStructure *&tempCS, CodingStructure *&
         }
 
         Distortion uiSad = distParam.distFunc(distParam);
+        candSatd[uiMergeCand] = uiSad;
         uint32_t uiBitsCand = uiMergeCand + 1;
         if( uiMergeCand == tempCS->slice->getMaxNumMergeCand() - 1 )
         {
@@ -1524,6 +1544,11 @@ void EncCu::xCheckRDCostMerge2Nx2N( CodingStructure *&tempCS, CodingStructure *&
         }
       }
 
+      if( !RdModeList.empty() )
+      {
+        m_modeCtrl->setMergeSatd( tempCS->area.Y(), candSatd[RdModeList[0]], sqrtLambdaForFirstPass );
+      }
+
       tempCS->initStructData( encTestMode.qp, encTestMode.lossless );
     }
     else
@@ -1576,8 +1601,13 @@ void EncCu::xCheckRDCostMerge2Nx2N( CodingStructure *&tempCS, CodingStructure *&
       }
       else
       {
-        m_pcInterSearch->motionCompensation( pu );
-        
+        PelUnitBuf predBuf = tempCS->getPredBuf( pu );
+
+        if( !m_mergePredCache.getPred( pu, predBuf ) )
+        {
+          m_pcInterSearch->motionCompensation( pu, predBuf );
+          m_mergePredCache.setPred( pu, predBuf );
+        }
       }
 
       xEncodeInterResidual( tempCS, bestCS, partitioner, encTestMode, uiNoResidualPass
@@ -107,8 +107,10 @@ private:
   RateCtrl*             m_pcRateCtrl;
   CodingStructure    ***m_pImvTempCS;
   EncModeCtrl          *m_modeCtrl;
+  CrossQpCache          m_crossQpCache;
 
   PelStorage            m_acMergeBuffer[MRG_MAX_NUM_CANDS];
+  MergePredCache        m_mergePredCache;
 
   MotionInfo            m_SubPuMiBuf      [( MAX_CU_SIZE * MAX_CU_SIZE ) >> ( MIN_CU_LOG2 << 1 )];
   unsigned int          m_subMergeBlkSize[10];
@@ -139,6 +141,7 @@ public:
   int   updateCtuDataISlice ( const CPelBuf buf );
 
   EncModeCtrl* getModeCtrl  () { return m_modeCtrl; }
+  CrossQpCache& getCrossQpCache() { return m_crossQpCache; }
 
   void clearSubMergeStatics()
   {
@@ -2049,6 +2049,11 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
 
       duData.clear();
 
+      if( m_pcEncLib->getMotionFieldCache()->isEnabled() )
+      {
+        m_pcEncLib->getMotionFieldCache()->store( *pcPic );
+      }
+
       CodingStructure& cs = *pcPic->cs;
       pcSlice = pcPic->slices[0];
 
@@ -2371,6 +2376,9 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
 
     DTRACE_UPDATE( g_trace_ctx, ( std::make_pair( "final", 0 ) ) );
 
+    // later pictures only read the motion of this one through the temporal motion vector prediction
+    pcPic->cs->compressMotion();
+
     pcPic->reconstructed = true;
     m_bFirst = false;
     m_iNumPicCoded++;
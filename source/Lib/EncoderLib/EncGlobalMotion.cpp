@@ -0,0 +1,635 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2018, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     EncGlobalMotion.cpp
+    \brief    picture level global motion estimation
+*/
+
+#include "EncGlobalMotion.h"
+
+#include "CommonLib/Picture.h"
+#include "CommonLib/Slice.h"
+
+#include <algorithm>
+#include <cmath>
+
+//! \ingroup EncoderLib
+//! \{
+
+//! solves the 3x3 system m * x = b by Gaussian elimination, false if it is (nearly) singular
+static bool xSolve3x3( double m[3][3], double b[3], double x[3] )
+{
+  for( int c = 0; c < 3; c++ )
+  {
+    int pivot = c;
+    for( int r = c + 1; r < 3; r++ )
+    {
+      if( std::abs( m[r][c] ) > std::abs( m[pivot][c] ) )
+      {
+        pivot = r;
+      }
+    }
+    if( std::abs( m[pivot][c] ) < 1e-9 )
+    {
+      return false;
+    }
+    if( pivot != c )
+    {
+      std::swap( m[pivot], m[c] );
+      std::swap( b[pivot], b[c] );
+    }
+    for( int r = c + 1; r < 3; r++ )
+    {
+      const double f = m[r][c] / m[c][c];
+      for( int k = c; k < 3; k++ )
+      {
+        m[r][k] -= f * m[c][k];
+      }
+      b[r] -= f * b[c];
+    }
+  }
+  for( int r = 2; r >= 0; r-- )
+  {
+    double s = b[r];
+    for( int k = r + 1; k < 3; k++ )
+    {
+      s -= m[r][k] * x[k];
+    }
+    x[r] = s / m[r][r];
+  }
+  return true;
+}
+
+void GlobalMotion::init( bool enabled, int searchRange )
+{
+  m_enabled       = enabled;
+  m_searchRange   = Clip3( 4, 16, searchRange >> LOG2_SCALE );
+  m_velocityValid = false;
+  m_velocityX     = 0;
+  m_velocityY     = 0;
+  m_planes.clear();
+  m_models.clear();
+}
+
+const GlobalMotion::Plane* GlobalMotion::xGetPlane( const Picture& pic ) const
+{
+  for( const Plane& plane : m_planes )
+  {
+    if( plane.pic == &pic && plane.poc == pic.getPOC() )
+    {
+      return &plane;
+    }
+  }
+
+  return nullptr;
+}
+
+const GlobalMotion::Plane& GlobalMotion::xBuildPlane( const Picture& pic, const int bitDepth[MAX_NUM_CHANNEL_TYPE] )
+{
+  m_planes.push_back( Plane() );
+
+  Plane& plane = m_planes.back();
+  plane.pic    = &pic;
+  plane.poc    = pic.getPOC();
+
+  const CPelUnitBuf org  = pic.getOrigBuf();
+  const CPelBuf     luma = org.get( COMPONENT_Y );
+  const int         numComp = ::getNumberValidComponents( org.chromaFormat );
+
+  plane.width  = luma.width  >> LOG2_SCALE;
+  plane.height = luma.height >> LOG2_SCALE;
+  plane.buf.resize( plane.width * plane.height );
+
+  for( int comp = 0; comp < numComp; comp++ )
+  {
+    plane.histogram[comp].assign( 1 << bitDepth[toChannelType( ComponentID( comp ) )], 0 );
+  }
+
+  // luma histogram and box-filtered downsampling in one pass over the original samples
+  std::vector<int>  acc( plane.width );
+  std::vector<int>& histY   = plane.histogram[COMPONENT_Y];
+  const int         maxPelY = int( histY.size() );
+  const int         mask    = ( 1 << LOG2_SCALE ) - 1;
+
+  for( int y = 0; y < luma.height; y++ )
+  {
+    const Pel* src = luma.bufAt( 0, y );
+
+    for( int x = 0; x < luma.width; x++ )
+    {
+      const Pel v = src[x];
+      histY[v < 0 ? 0 : ( v >= maxPelY ) ? maxPelY - 1 : v]++;
+    }
+
+    if( ( y >> LOG2_SCALE ) >= plane.height )
+    {
+      continue;
+    }
+    if( ( y & mask ) == 0 )
+    {
+      std::fill( acc.begin(), acc.end(), 0 );
+    }
+    for( int x = 0; x < ( plane.width << LOG2_SCALE ); x++ )
+    {
+      acc[x >> LOG2_SCALE] += src[x];
+    }
+    if( ( y & mask ) == mask )
+    {
+      Pel* dst = &plane.buf[( y >> LOG2_SCALE ) * plane.width];
+      for( int x = 0; x < plane.width; x++ )
+      {
+        dst[x] = Pel( ( acc[x] + ( 1 << ( 2 * LOG2_SCALE - 1 ) ) ) >> ( 2 * LOG2_SCALE ) );
+      }
+    }
+  }
+
+  for( int comp = 1; comp < numComp; comp++ )
+  {
+    const CPelBuf     chroma = org.get( ComponentID( comp ) );
+    std::vector<int>& hist   = plane.histogram[comp];
+    const int         maxPel = int( hist.size() );
+
+    for( int y = 0; y < chroma.height; y++ )
+    {
+      const Pel* src = chroma.bufAt( 0, y );
+
+      for( int x = 0; x < chroma.width; x++ )
+      {
+        const Pel v = src[x];
+        hist[v < 0 ? 0 : ( v >= maxPel ) ? maxPel - 1 : v]++;
+      }
+    }
+  }
+
+  return plane;
+}
+
+void GlobalMotion::xEstimate( const Plane& cur, const Plane& ref, const int pocDist, const int bitDepth, Model& model ) const
+{
+  model.valid = false;
+  std::fill( model.a, model.a + 6, 0.0 );
+
+  const int blkSize = 1 << LOG2_BLOCK_SIZE;
+  const int numBlkX = cur.width  >> LOG2_BLOCK_SIZE;
+  const int numBlkY = cur.height >> LOG2_BLOCK_SIZE;
+  const int range   = m_searchRange;
+
+  if( numBlkX * numBlkY < 6 || ref.width != cur.width || ref.height != cur.height )
+  {
+    return;
+  }
+
+  // the second search window is centred on the motion predicted from the previous picture
+  int predX = 0;
+  int predY = 0;
+  if( m_velocityValid )
+  {
+    predX = Clip3( -4 * range, 4 * range, int( std::lround( m_velocityX * pocDist / ( 1 << LOG2_SCALE ) ) ) );
+    predY = Clip3( -4 * range, 4 * range, int( std::lround( m_velocityY * pocDist / ( 1 << LOG2_SCALE ) ) ) );
+  }
+  const int numWindows = ( predX != 0 || predY != 0 ) ? 2 : 1;
+
+  // blocks with a mean absolute deviation below 2 (8 bit) cannot be matched reliably
+  const int minActivity = ( 2 << ( bitDepth - 8 ) ) << ( 2 * LOG2_BLOCK_SIZE );
+
+  struct Vector
+  {
+    bool valid;
+    int  dx;
+    int  dy;
+  };
+  std::vector<Vector> vectors( numBlkX * numBlkY );
+
+#pragma omp parallel for schedule(dynamic,1)
+  for( int by = 0; by < numBlkY; by++ )
+  {
+    for( int bx = 0; bx < numBlkX; bx++ )
+    {
+      Vector& vec = vectors[by * numBlkX + bx];
+      vec.valid   = false;
+
+      const int  x0  = bx << LOG2_BLOCK_SIZE;
+      const int  y0  = by << LOG2_BLOCK_SIZE;
+      const Pel* org = &cur.buf[y0 * cur.width + x0];
+
+      int sum = 0;
+      for( int y = 0; y < blkSize; y++ )
+      {
+        for( int x = 0; x < blkSize; x++ )
+        {
+          sum += org[y * cur.width + x];
+        }
+      }
+      const int mean     = ( sum + ( 1 << ( 2 * LOG2_BLOCK_SIZE - 1 ) ) ) >> ( 2 * LOG2_BLOCK_SIZE );
+      int       activity = 0;
+      for( int y = 0; y < blkSize; y++ )
+      {
+        for( int x = 0; x < blkSize; x++ )
+        {
+          activity += abs( org[y * cur.width + x] - mean );
+        }
+      }
+      if( activity < minActivity )
+      {
+        continue;
+      }
+
+      int bestSad = std::numeric_limits<int>::max();
+      int bestX   = 0;
+      int bestY   = 0;
+
+      for( int w = 0; w < numWindows; w++ )
+      {
+        const int cx = w ? predX : 0;
+        const int cy = w ? predY : 0;
+
+        for( int dy = cy - range; dy <= cy + range; dy++ )
+        {
+          for( int dx = cx - range; dx <= cx + range; dx++ )
+          {
+            if( w && abs( dx ) <= range && abs( dy ) <= range )
+            {
+              continue;
+            }
+            if( x0 + dx < 0 || y0 + dy < 0 || x0 + dx + blkSize > ref.width || y0 + dy + blkSize > ref.height )
+            {
+              continue;
+            }
+
+            const Pel* refBlk = &ref.buf[( y0 + dy ) * ref.width + x0 + dx];
+            int        sad    = 0;
+            // only stop once the candidate is strictly worse, a partial sum equal to bestSad could win the tie-break
+            for( int y = 0; y < blkSize && sad <= bestSad; y++ )
+            {
+              for( int x = 0; x < blkSize; x++ )
+              {
+                sad += abs( org[y * cur.width + x] - refBlk[y * ref.width + x] );
+              }
+            }
+            if( sad < bestSad || ( sad == bestSad && abs( dx ) + abs( dy ) < abs( bestX ) + abs( bestY ) ) )
+            {
+              bestSad = sad;
+              bestX   = dx;
+              bestY   = dy;
+            }
+          }
+        }
+      }
+
+      // a match not better than the flat block is ambiguous, e.g. an uncovered area or a repetitive texture
+      if( bestSad < activity )
+      {
+        vec.valid = true;
+        vec.dx    = bestX << LOG2_SCALE;
+        vec.dy    = bestY << LOG2_SCALE;
+      }
+    }
+  }
+
+  // robust fit on coordinates relative to the picture centre, normalized by the width
+  struct Sample
+  {
+    double u;
+    double v;
+    double dx;
+    double dy;
+  };
+  std::vector<Sample> samples;
+  const double centreX = ( cur.width  << LOG2_SCALE ) / 2.0;
+  const double centreY = ( cur.height << LOG2_SCALE ) / 2.0;
+  const double norm    = cur.width << LOG2_SCALE;
+
+  for( int by = 0; by < numBlkY; by++ )
+  {
+    for( int bx = 0; bx < numBlkX; bx++ )
+    {
+      const Vector& vec = vectors[by * numBlkX + bx];
+      if( vec.valid )
+      {
+        const double x = ( ( bx << LOG2_BLOCK_SIZE ) + ( blkSize >> 1 ) ) << LOG2_SCALE;
+        const double y = ( ( by << LOG2_BLOCK_SIZE ) + ( blkSize >> 1 ) ) << LOG2_SCALE;
+        samples.push_back( { ( x - centreX ) / norm, ( y - centreY ) / norm, double( vec.dx ), double( vec.dy ) } );
+      }
+    }
+  }
+
+  const int numSamples = int( samples.size() );
+  if( numSamples < 6 )
+  {
+    return;
+  }
+
+  std::vector<uint8_t> inlier( numSamples, 1 );
+  std::vector<double>  residual( numSamples );
+  double               px[3] = { 0, 0, 0 };
+  double               py[3] = { 0, 0, 0 };
+  int                  numInliers = numSamples;
+
+  // a least squares fit over all vectors is easily pulled away by mismatches, start from the median translation
+  {
+    std::vector<double> dxs( numSamples );
+    std::vector<double> dys( numSamples );
+    for( int i = 0; i < numSamples; i++ )
+    {
+      dxs[i] = samples[i].dx;
+      dys[i] = samples[i].dy;
+    }
+    std::nth_element( dxs.begin(), dxs.begin() + numSamples / 2, dxs.end() );
+    std::nth_element( dys.begin(), dys.begin() + numSamples / 2, dys.end() );
+    const double medX = dxs[numSamples / 2];
+    const double medY = dys[numSamples / 2];
+
+    for( int i = 0; i < numSamples; i++ )
+    {
+      residual[i] = std::abs( samples[i].dx - medX ) + std::abs( samples[i].dy - medY );
+      dxs[i]      = residual[i];
+    }
+    std::nth_element( dxs.begin(), dxs.begin() + numSamples / 2, dxs.end() );
+    const double threshold = std::max( 2.0 * dxs[numSamples / 2], double( 1 << LOG2_SCALE ) );
+
+    numInliers = 0;
+    for( int i = 0; i < numSamples; i++ )
+    {
+      inlier[i]   = residual[i] <= threshold;
+      numInliers += inlier[i];
+    }
+    if( numInliers < 6 )
+    {
+      return;
+    }
+  }
+
+  for( int round = 0; round < NUM_FIT_ROUNDS; round++ )
+  {
+    double m[3][3] = { { 0 } };
+    double bx[3]   = { 0, 0, 0 };
+    double by[3]   = { 0, 0, 0 };
+
+    for( int i = 0; i < numSamples; i++ )
+    {
+      if( !inlier[i] )
+      {
+        continue;
+      }
+      const double p[3] = { 1.0, samples[i].u, samples[i].v };
+      for( int r = 0; r < 3; r++ )
+      {
+        for( int c = 0; c < 3; c++ )
+        {
+          m[r][c] += p[r] * p[c];
+        }
+        bx[r] += p[r] * samples[i].dx;
+        by[r] += p[r] * samples[i].dy;
+      }
+    }
+
+    double m2[3][3];
+    std::copy( &m[0][0], &m[0][0] + 9, &m2[0][0] );
+    if( !xSolve3x3( m, bx, px ) || !xSolve3x3( m2, by, py ) )
+    {
+      return;
+    }
+
+    if( round == NUM_FIT_ROUNDS - 1 )
+    {
+      break;
+    }
+
+    // reject the vectors far from the model, at least one downsampled sample is tolerated
+    std::vector<double> inlierResidual;
+    for( int i = 0; i < numSamples; i++ )
+    {
+      const Sample& s = samples[i];
+      residual[i] = std::abs( s.dx - ( px[0] + px[1] * s.u + px[2] * s.v ) ) + std::abs( s.dy - ( py[0] + py[1] * s.u + py[2] * s.v ) );
+      if( inlier[i] )
+      {
+        inlierResidual.push_back( residual[i] );
+      }
+    }
+    std::nth_element( inlierResidual.begin(), inlierResidual.begin() + inlierResidual.size() / 2, inlierResidual.end() );
+    const double threshold = std::max( 2.0 * inlierResidual[inlierResidual.size() / 2], double( 1 << LOG2_SCALE ) );
+
+    numInliers = 0;
+    for( int i = 0; i < numSamples; i++ )
+    {
+      inlier[i]   = residual[i] <= threshold;
+      numInliers += inlier[i];
+    }
+    if( numInliers < 6 )
+    {
+      return;
+    }
+  }
+
+  // the model has to describe the dominant motion of the picture
+  if( numInliers * 5 < numSamples * 2 )
+  {
+    return;
+  }
+
+  // zooms or rotations beyond 10 percent between two pictures are rather a sign of a failed fit
+  const double maxDeform = 0.1 * norm;
+  if( std::abs( px[1] ) > maxDeform || std::abs( px[2] ) > maxDeform || std::abs( py[1] ) > maxDeform || std::abs( py[2] ) > maxDeform )
+  {
+    return;
+  }
+
+  model.valid = true;
+  model.a[1]  = px[1] / norm;
+  model.a[2]  = px[2] / norm;
+  model.a[0]  = px[0] - model.a[1] * centreX - model.a[2] * centreY;
+  model.a[4]  = py[1] / norm;
+  model.a[5]  = py[2] / norm;
+  model.a[3]  = py[0] - model.a[4] * centreX - model.a[5] * centreY;
+}
+
+void GlobalMotion::analyse( const Slice& slice )
+{
+  const Picture& pic = *slice.getPic();
+  const int      poc = slice.getPOC();
+  const int      bitDepth[MAX_NUM_CHANNEL_TYPE] = { slice.getSPS()->getBitDepth( CHANNEL_TYPE_LUMA ), slice.getSPS()->getBitDepth( CHANNEL_TYPE_CHROMA ) };
+  const int      numLists = slice.isInterB() ? 2 : slice.isInterP() ? 1 : 0;
+
+  auto isNeeded = [&]( const int planePoc )
+  {
+    if( planePoc == poc )
+    {
+      return true;
+    }
+    for( int l = 0; l < numLists; l++ )
+    {
+      for( int i = 0; i < slice.getNumRefIdx( RefPicList( l ) ); i++ )
+      {
+        if( slice.getRefPOC( RefPicList( l ), i ) == planePoc )
+        {
+          return true;
+        }
+      }
+    }
+    return false;
+  };
+
+  // keep the planes of the current picture and its references and the models of the current picture
+  m_planes.erase( std::remove_if( m_planes.begin(), m_planes.end(), [&]( const Plane& plane ) { return !isNeeded( plane.poc ); } ), m_planes.end() );
+  m_models.erase( std::remove_if( m_models.begin(), m_models.end(), [&]( const Entry& entry ) { return entry.poc != poc; } ), m_models.end() );
+
+  const Plane* cur = xGetPlane( pic );
+  if( !cur )
+  {
+    cur = &xBuildPlane( pic, bitDepth );
+  }
+
+  for( int l = 0; l < numLists; l++ )
+  {
+    for( int i = 0; i < slice.getNumRefIdx( RefPicList( l ) ); i++ )
+    {
+      const Picture* refPic = slice.getRefPic( RefPicList( l ), i );
+      const int      refPoc = refPic->getPOC();
+
+      if( refPic->longTerm || refPoc == poc ||
+          std::any_of( m_models.begin(), m_models.end(), [&]( const Entry& entry ) { return entry.refPoc == refPoc; } ) )
+      {
+        continue;
+      }
+
+      const Plane* ref = xGetPlane( *refPic );
+      if( !ref )
+      {
+        ref = &xBuildPlane( *refPic, bitDepth );
+      }
+
+      m_models.push_back( Entry() );
+      Entry& entry = m_models.back();
+      entry.poc    = poc;
+      entry.refPoc = refPoc;
+      xEstimate( *cur, *ref, refPoc - poc, bitDepth[CHANNEL_TYPE_LUMA], entry.model );
+
+      if( entry.model.valid )
+      {
+        const double cx = pic.lwidth()  / 2.0;
+        const double cy = pic.lheight() / 2.0;
+        m_velocityValid = true;
+        m_velocityX     = ( entry.model.a[0] + entry.model.a[1] * cx + entry.model.a[2] * cy ) / ( refPoc - poc );
+        m_velocityY     = ( entry.model.a[3] + entry.model.a[4] * cx + entry.model.a[5] * cy ) / ( refPoc - poc );
+      }
+    }
+  }
+}
+
+const GlobalMotion::Model* GlobalMotion::xGetModel( const Slice& slice, const RefPicList eRefPicList, const int iRefIdx ) const
+{
+  const Picture* refPic = slice.getRefPic( eRefPicList, iRefIdx );
+
+  if( refPic->longTerm )
+  {
+    return nullptr;
+  }
+
+  for( const Entry& entry : m_models )
+  {
+    if( entry.poc == slice.getPOC() && entry.refPoc == refPic->getPOC() )
+    {
+      return entry.model.valid ? &entry.model : nullptr;
+    }
+  }
+
+  return nullptr;
+}
+
+bool GlobalMotion::getMv( const PredictionUnit& pu, const RefPicList eRefPicList, const int iRefIdx, Mv& mv ) const
+{
+  const Model* model = xGetModel( *pu.cs->slice, eRefPicList, iRefIdx );
+
+  if( !model )
+  {
+    return false;
+  }
+
+  const Position centre = pu.Y().center();
+  const double   dx     = model->a[0] + model->a[1] * centre.x + model->a[2] * centre.y;
+  const double   dy     = model->a[3] + model->a[4] * centre.x + model->a[5] * centre.y;
+
+  // integer-pel start point
+  mv = Mv( int( std::lround( dx ) ) << 2, int( std::lround( dy ) ) << 2 );
+
+  return true;
+}
+
+bool GlobalMotion::getAffineMvs( const PredictionUnit& pu, const RefPicList eRefPicList, const int iRefIdx, Mv mv[3] ) const
+{
+  const Model* model = xGetModel( *pu.cs->slice, eRefPicList, iRefIdx );
+
+  if( !model )
+  {
+    return false;
+  }
+
+  const Position pos[3] = { pu.Y().topLeft(), pu.Y().topLeft().offset( pu.lwidth(), 0 ), pu.Y().topLeft().offset( 0, pu.lheight() ) };
+
+  for( int i = 0; i < 3; i++ )
+  {
+    const double dx = model->a[0] + model->a[1] * pos[i].x + model->a[2] * pos[i].y;
+    const double dy = model->a[3] + model->a[4] * pos[i].x + model->a[5] * pos[i].y;
+
+    mv[i] = Mv( int( std::lround( 4 * dx ) ), int( std::lround( 4 * dy ) ) );
+  }
+
+  return true;
+}
+
+bool GlobalMotion::getShift( const Slice& slice, const RefPicList eRefPicList, const int iRefIdx, int& dx, int& dy ) const
+{
+  const Model* model = xGetModel( slice, eRefPicList, iRefIdx );
+
+  if( !model )
+  {
+    return false;
+  }
+
+  const double cx = slice.getPic()->lwidth()  / 2.0;
+  const double cy = slice.getPic()->lheight() / 2.0;
+
+  dx = int( std::lround( model->a[0] + model->a[1] * cx + model->a[2] * cy ) );
+  dy = int( std::lround( model->a[3] + model->a[4] * cx + model->a[5] * cy ) );
+
+  return true;
+}
+
+const std::vector<int>* GlobalMotion::getHistogram( const Picture& pic, const ComponentID compID ) const
+{
+  const Plane* plane = xGetPlane( pic );
+
+  return plane && !plane->histogram[compID].empty() ? &plane->histogram[compID] : nullptr;
+}
+
+//! \}
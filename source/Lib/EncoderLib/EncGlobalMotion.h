@@ -0,0 +1,126 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2018, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     EncGlobalMotion.h
+    \brief    picture level global motion estimation (header)
+*/
+
+#ifndef __ENCGLOBALMOTION__
+#define __ENCGLOBALMOTION__
+
+#include "CommonLib/CommonDef.h"
+#include "CommonLib/Mv.h"
+#include "CommonLib/Unit.h"
+
+#include <deque>
+#include <vector>
+
+//! \ingroup EncoderLib
+//! \{
+
+class Picture;
+class Slice;
+
+// ====================================================================================================================
+// Class definition
+// ====================================================================================================================
+
+/// camera motion of a picture towards its reference pictures, a 6-parameter affine model per reference estimated by
+/// block matching on a downsampled luma plane of the original pictures and a least squares fit rejecting outliers
+class GlobalMotion
+{
+public:
+  static const int LOG2_SCALE       = 2;  ///< downsampling of the luma plane used for the block matching
+  static const int LOG2_BLOCK_SIZE  = 3;  ///< size of the matched blocks, in downsampled samples
+  static const int NUM_FIT_ROUNDS   = 4;
+
+  /// displacement in luma samples at (x, y): ( a[0] + a[1] * x + a[2] * y, a[3] + a[4] * x + a[5] * y )
+  struct Model
+  {
+    bool   valid;
+    double a[6];
+  };
+
+  GlobalMotion() : m_enabled( false ), m_searchRange( 0 ), m_velocityValid( false ), m_velocityX( 0 ), m_velocityY( 0 ) {}
+
+  void init         ( bool enabled, int searchRange );
+  bool isEnabled    () const { return m_enabled; }
+
+  /// estimates the models of the picture of the slice towards the reference pictures of the slice and gathers the
+  /// sample histograms of the original picture in the same pass, models already known are kept
+  void analyse      ( const Slice& slice );
+
+  /// integer-pel start point for the ME of the PU, in 1/4 sample units
+  bool getMv        ( const PredictionUnit& pu, const RefPicList eRefPicList, const int iRefIdx, Mv& mv ) const;
+  /// motion of the three affine control points of the PU, in 1/4 sample units
+  bool getAffineMvs ( const PredictionUnit& pu, const RefPicList eRefPicList, const int iRefIdx, Mv mv[3] ) const;
+  /// integer translation of the model at the centre of the picture, in luma samples
+  bool getShift     ( const Slice& slice, const RefPicList eRefPicList, const int iRefIdx, int& dx, int& dy ) const;
+  /// sample histogram of a component of the original picture, nullptr if the picture has not been analysed
+  const std::vector<int>* getHistogram( const Picture& pic, const ComponentID compID ) const;
+
+private:
+  struct Plane
+  {
+    const Picture*   pic;
+    int              poc;
+    int              width;             ///< of the downsampled luma
+    int              height;
+    std::vector<Pel> buf;
+    std::vector<int> histogram[MAX_NUM_COMPONENT];
+  };
+
+  struct Entry
+  {
+    int   poc;
+    int   refPoc;
+    Model model;
+  };
+
+  const Plane* xGetPlane   ( const Picture& pic ) const;
+  const Plane& xBuildPlane ( const Picture& pic, const int bitDepth[MAX_NUM_CHANNEL_TYPE] );
+  void         xEstimate   ( const Plane& cur, const Plane& ref, const int pocDist, const int bitDepth, Model& model ) const;
+  const Model* xGetModel   ( const Slice& slice, const RefPicList eRefPicList, const int iRefIdx ) const;
+
+  bool               m_enabled;
+  int                m_searchRange;     ///< in downsampled samples
+  std::deque<Plane>  m_planes;
+  std::vector<Entry> m_models;          ///< of the pictures of the planes
+  bool               m_velocityValid;   ///< translation per POC of the last valid model, predicts the next search
+  double             m_velocityX;
+  double             m_velocityY;
+};
+
+//! \}
+
+#endif // __ENCGLOBALMOTION__
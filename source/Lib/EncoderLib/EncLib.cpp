@@ -165,6 +165,7 @@ void EncLib::destroy ()
   m_cEncSAO.            destroy();
   m_cLoopFilter.        destroy();
   m_cRateCtrl.          destroy();
+  m_cRefSubPelCache.    destroy();
 #if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
   for( int jId = 0; jId < m_numCuEncStacks; jId++ )
   {
@@ -255,6 +256,10 @@ void EncLib::init( bool isFieldCoding, AUWriterIf* auWriterIf )
     xInitPPSforLT(pps2);
   }
 
+  m_cMotionFieldCache.init( m_temporalMvSeeds, MAX_NUM_REF + 1 );
+  m_cGlobalMotion.init( m_globalMotionEstimation, m_iSearchRange );
+  m_cRefSubPelCache.init( m_refSubPelCache, m_maxCUWidth );
+
   // initialize processing unit classes
   m_cGOPEncoder.  init( this );
   m_cSliceEncoder.init( this, sps0 );
@@ -482,6 +487,8 @@ void EncLib::deletePicBuffer()
     delete pcPic;
     pcPic = NULL;
   }
+
+  g_picBufferPool.trim();
 }
 
 /**
@@ -744,6 +751,9 @@ void EncLib::xGetNewPicBuffer ( std::list<PelUnitBuf*>& rcListPicYuvRecOut, Pict
     rpcPic = new Picture;
 
     rpcPic->create( sps.getChromaFormatIdc(), Size( sps.getPicWidthInLumaSamples(), sps.getPicHeightInLumaSamples()), sps.getMaxCUWidth(), sps.getMaxCUWidth()+16, false );
+
+    // planes of a destroyed picture not reused by the new one are not needed anymore
+    g_picBufferPool.trim();
     if ( getUseAdaptiveQP() )
     {
       const uint32_t iMaxDQPLayer = pps.getMaxCuDQPDepth()+1;
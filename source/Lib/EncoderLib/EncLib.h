@@ -55,6 +55,9 @@
 #include "EncSampleAdaptiveOffset.h"
 #include "EncAdaptiveLoopFilter.h"
 #include "RateCtrl.h"
+#include "EncMotionFieldCache.h"
+#include "EncGlobalMotion.h"
+#include "EncRefSubPelCache.h"
 
 
 //! \ingroup EncoderLib
@@ -119,6 +122,9 @@ private:
 #endif
   // quality control
   RateCtrl                  m_cRateCtrl;                          ///< Rate control class
+  MotionFieldCache          m_cMotionFieldCache;                  ///< motion of coded pictures for seeding the ME
+  GlobalMotion              m_cGlobalMotion;                      ///< camera motion of the pictures for the ME and WP
+  RefSubPelCache            m_cRefSubPelCache;                    ///< sub-sample planes of the reference pictures for the ME
 
   AUWriterIf*               m_AUWriterIf;
 
@@ -203,6 +209,9 @@ public:
   CtxCache*               getCtxCache           ()              { return  &m_CtxCache;             }
 #endif
   RateCtrl*               getRateCtrl           ()              { return  &m_cRateCtrl;            }
+  MotionFieldCache*       getMotionFieldCache   ()              { return  &m_cMotionFieldCache;    }
+  GlobalMotion*           getGlobalMotion       ()              { return  &m_cGlobalMotion;        }
+  RefSubPelCache*         getRefSubPelCache     ()              { return  &m_cRefSubPelCache;      }
 
 
   void selectReferencePictureSet(Slice* slice, int POCCurr, int GOPid
@@ -238,7 +247,12 @@ public:
                int& iNumEncoded, bool isTff );
 
 
-  void printSummary(bool isField) { m_cGOPEncoder.printOutSummary (m_uiNumAllPicCoded, isField, m_printMSEBasedSequencePSNR, m_printSequenceMSE, m_printHexPsnr, m_spsMap.getFirstPS()->getBitDepths()); }
+  void printSummary(bool isField)
+  {
+    m_cGOPEncoder.printOutSummary (m_uiNumAllPicCoded, isField, m_printMSEBasedSequencePSNR, m_printSequenceMSE, m_printHexPsnr, m_spsMap.getFirstPS()->getBitDepths());
+    m_cRefSubPelCache.report();
+    Picture::reportBufferMemory();
+  }
 
 };
 
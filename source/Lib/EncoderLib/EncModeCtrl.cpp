@@ -49,12 +49,76 @@
 
 #include <cmath>
 
+void MergeSkipModel::init( bool enabled )
+{
+  m_enabled = enabled;
+
+  ::memset( m_count,     0, sizeof( m_count     ) );
+  ::memset( m_total,     0, sizeof( m_total     ) );
+  ::memset( m_threshold, 0, sizeof( m_threshold ) );
+}
+
+int MergeSkipModel::getBin( const Distortion satd, const Area& area, const double sqrtLambda )
+{
+  const double satdPerSample = double( satd ) / ( double( area.area() ) * std::max( sqrtLambda, 1.0 ) );
+
+  if( satdPerSample <= 0.0 )
+  {
+    return 0;
+  }
+
+  return Clip3( 0, NUM_BINS - 1, int( std::floor( 4.0 * std::log2( satdPerSample ) ) ) + 24 );
+}
+
+void MergeSkipModel::addSample( const Area& area, const int bin, const bool isSkip )
+{
+  const int sizeClass = xGetSizeClass( area );
+
+  m_count[sizeClass][isSkip][bin]++;
+
+  // halve the history so that the statistics follow the content
+  if( ++m_total[sizeClass] >= MAX_SAMPLES )
+  {
+    m_total[sizeClass] = 0;
+
+    for( int b = 0; b < NUM_BINS; b++ )
+    {
+      m_count[sizeClass][0][b] >>= 1;
+      m_count[sizeClass][1][b] >>= 1;
+      m_total[sizeClass]        += m_count[sizeClass][0][b] + m_count[sizeClass][1][b];
+    }
+  }
+
+  uint32_t numSkip  = 0;
+  uint32_t numOther = 0;
+
+  m_threshold[sizeClass] = 0;
+
+  for( int b = 0; b < NUM_BINS; b++ )
+  {
+    numSkip  += m_count[sizeClass][1][b];
+    numOther += m_count[sizeClass][0][b];
+
+    if( numOther * 1000 > MAX_MISS_RATE * ( numSkip + numOther ) )
+    {
+      break;
+    }
+
+    if( numSkip >= MIN_SKIP_SAMPLES )
+    {
+      m_threshold[sizeClass] = b + 1;
+    }
+  }
+}
+
 void EncModeCtrl::init( EncCfg *pCfg, RateCtrl *pRateCtrl, RdCost* pRdCost )
 {
   m_pcEncCfg      = pCfg;
   m_pcRateCtrl    = pRateCtrl;
   m_pcRdCost      = pRdCost;
   m_fastDeltaQP   = false;
+  m_splitPredictor.init( *pCfg );
+  m_mergeSkipModel.init( pCfg->getUseMergeSatdSkip() );
 #if SHARP_LUMA_DELTA_QP
   m_lumaQPOffset  = 0;
 
@@ -81,6 +145,27 @@ void EncModeCtrl::setEarlySkipDetected()
   m_ComprCUCtxList.back().earlySkip = true;
 }
 
+void EncModeCtrl::setMergeSatd( const Area& area, const Distortion satd, const double sqrtLambda )
+{
+  if( !m_mergeSkipModel.isEnabled() )
+  {
+    return;
+  }
+
+  ComprCUCtx& cuECtx = m_ComprCUCtxList.back();
+  const int   bin    = MergeSkipModel::getBin( satd, area, sqrtLambda );
+
+  if( cuECtx.mergeSatdBin < 0 || bin < cuECtx.mergeSatdBin )
+  {
+    cuECtx.mergeSatdBin = bin;
+  }
+
+  if( m_mergeSkipModel.predictSkip( area, bin ) )
+  {
+    cuECtx.mergeSatdSkip = true;
+  }
+}
+
 void EncModeCtrl::xExtractFeatures( const EncTestMode encTestmode, CodingStructure& cs )
 {
   CHECK( cs.features.size() < NUM_ENC_FEATURES, "Features vector is not initialized" );
@@ -503,6 +588,42 @@ bool CacheBlkInfoCtrl::getMv( const UnitArea& area, const RefPicList refPicList,
   return m_codedCUInfo[idx1][idx2][idx3][idx4]->validMv[refPicList][iRefIdx];
 }
 
+void CrossQpCache::reset()
+{
+  m_mvInfo.clear();
+}
+
+bool CrossQpCache::getMv( const CompArea& area, const RefPicList refPicList, const int iRefIdx, const int qp, Mv& rMv ) const
+{
+  if( iRefIdx >= MAX_STORED_CU_INFO_REFS ) return false;
+
+  const auto it = m_mvInfo.find( key( area ) );
+
+  if( it == m_mvInfo.end() || !it->second.validMv[refPicList][iRefIdx] || it->second.qp[refPicList][iRefIdx] == qp )
+  {
+    return false;
+  }
+
+  rMv = it->second.saveMv[refPicList][iRefIdx];
+  return true;
+}
+
+void CrossQpCache::setMv( const CompArea& area, const RefPicList refPicList, const int iRefIdx, const int qp, const Mv& rMv )
+{
+  if( iRefIdx >= MAX_STORED_CU_INFO_REFS ) return;
+
+  auto res = m_mvInfo.emplace( key( area ), MvInfo() );
+
+  if( res.second )
+  {
+    memset( &res.first->second, 0, sizeof( MvInfo ) );
+  }
+
+  res.first->second.qp     [refPicList][iRefIdx] = qp;
+  res.first->second.saveMv [refPicList][iRefIdx] = rMv;
+  res.first->second.validMv[refPicList][iRefIdx] = true;
+}
+
 
 #if REUSE_CU_RESULTS
 static bool isTheSameNbHood( const CodingUnit &cu, const Partitioner &partitioner )
@@ -656,10 +777,10 @@ void BestEncInfoCache::init( const Slice &slice )
     }
   }
 
-  m_pCoeff  = new TCoeff[numCoeff];
+  m_pCoeff  = new TCoeffLevel[numCoeff];
   m_pPcmBuf = new Pel   [numCoeff];
 
-  TCoeff *coeffPtr = m_pCoeff;
+  TCoeffLevel *coeffPtr = m_pCoeff;
   Pel    *pcmPtr   = m_pPcmBuf;
 
   m_dummyCS.pcv = m_slice_bencinf->getPPS()->pcv;
@@ -674,7 +795,7 @@ void BestEncInfoCache::init( const Slice &slice )
         {
           if( m_bestEncInfo[x][y][wIdx][hIdx] )
           {
-            TCoeff *coeff[MAX_NUM_TBLOCKS] = { 0, };
+            TCoeffLevel *coeff[MAX_NUM_TBLOCKS] = { 0, };
             Pel    *pcmbf[MAX_NUM_TBLOCKS] = { 0, };
 
             const UnitArea &area = m_bestEncInfo[x][y][wIdx][hIdx]->tu;
@@ -853,7 +974,9 @@ void EncModeCtrlMTnoRQT::initCULevel( Partitioner &partitioner, const CodingStru
     }
   }
 
-  m_ComprCUCtxList.push_back( ComprCUCtx( cs, minDepth, maxDepth, NUM_EXTRA_FEATURES ) );
+  // copied rather than moved in, so the test mode list of the level keeps its capacity from the previous CUs
+  const ComprCUCtx newCtx( cs, minDepth, maxDepth, NUM_EXTRA_FEATURES );
+  m_ComprCUCtxList.push_back( newCtx );
 
 #if ENABLE_SPLIT_PARALLELISM
   if( m_runNextInParallel )
@@ -1075,6 +1198,21 @@ void EncModeCtrlMTnoRQT::initCULevel( Partitioner &partitioner, const CodingStru
 
 void EncModeCtrlMTnoRQT::finishCULevel( Partitioner &partitioner )
 {
+  const ComprCUCtx& cuECtx = m_ComprCUCtxList.back();
+
+  if( cuECtx.bestCS )
+  {
+    m_splitPredictor.dump( cuECtx.splitFeatures, getPartSplit( getCSEncMode( *cuECtx.bestCS ) ) );
+  }
+
+  // CUs ended by the skip model are not used for training, they would only confirm the prediction
+  if( cuECtx.bestCS && cuECtx.mergeSatdBin >= 0 && !cuECtx.mergeSatdSkip )
+  {
+    const bool isSkip = cuECtx.bestCS->cus.size() == 1 && cuECtx.bestCU->skip;
+
+    m_mergeSkipModel.addSample( cuECtx.bestCS->area.Y(), cuECtx.mergeSatdBin, isSkip );
+  }
+
   m_ComprCUCtxList.pop_back();
 }
 
@@ -1093,6 +1231,12 @@ bool EncModeCtrlMTnoRQT::tryMode( const EncTestMode& encTestmode, const CodingSt
     return false;
   }
 
+  // if the merge SATD predicts skip, only the merge modes of the remaining QPs and the splits are checked
+  if( cuECtx.mergeSatdSkip && !isModeSplit( encTestmode ) && encTestmode.type != ETM_MERGE_SKIP )
+  {
+    return false;
+  }
+
   const PartSplit implicitSplit = partitioner.getImplicitSplit( cs );
   const bool isBoundary         = implicitSplit != CU_DONT_SPLIT;
 
@@ -1307,6 +1451,14 @@ bool EncModeCtrlMTnoRQT::tryMode( const EncTestMode& encTestmode, const CodingSt
       return false;
     }
 
+    if( m_splitPredictor.prune( cuECtx.splitFeatures, split ) )
+    {
+      if( split == CU_HORZ_SPLIT ) cuECtx.set( DID_HORZ_SPLIT, false );
+      if( split == CU_VERT_SPLIT ) cuECtx.set( DID_VERT_SPLIT, false );
+
+      return false;
+    }
+
     if( m_pcEncCfg->getUseContentBasedFastQtbt() )
     {
       const CompArea& currArea = partitioner.currArea().Y();
@@ -1462,6 +1614,12 @@ bool EncModeCtrlMTnoRQT::tryMode( const EncTestMode& encTestmode, const CodingSt
   {
     CHECK( encTestmode.type != ETM_POST_DONT_SPLIT, "Unknown mode" );
 
+    if( m_splitPredictor.isActive() )
+    {
+      // all non-split modes are done at this point, the splits follow
+      m_splitPredictor.extract( cuECtx.splitFeatures, cs, partitioner, bestCS, m_pcRdCost );
+    }
+
     if( !bestCS || ( bestCS && isModeSplit( bestMode ) ) )
     {
       return false;
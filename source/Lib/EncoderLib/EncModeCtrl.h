@@ -40,11 +40,13 @@
 
 // Include files
 #include "EncCfg.h"
+#include "EncSplitPredictor.h"
 
 #include "CommonLib/CommonDef.h"
 #include "CommonLib/CodingStructure.h"
 
 #include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
 //////////////////////////////////////////////////////////////////////////
@@ -167,6 +169,7 @@ struct ComprCUCtx
 {
   ComprCUCtx() : testModes(), extraFeatures()
   {
+    splitFeatures.valid = false;
   }
 
   ComprCUCtx( const CodingStructure& cs, const uint32_t _minDepth, const uint32_t _maxDepth, const uint32_t numExtraFeatures )
@@ -186,6 +189,8 @@ struct ComprCUCtx
     , skipSecondEMTPass
                     ( false   )
     , interHad      (std::numeric_limits<Distortion>::max())
+    , mergeSatdBin  ( -1         )
+    , mergeSatdSkip ( false      )
 #if ENABLE_SPLIT_PARALLELISM
     , isLevelSplitParallel
                     ( false )
@@ -199,6 +204,8 @@ struct ComprCUCtx
 
     extraFeaturesd.reserve( numExtraFeatures );
     extraFeaturesd.resize ( numExtraFeatures, 0.0 );
+
+    splitFeatures.valid = false;
   }
 
   unsigned                          minDepth;
@@ -216,6 +223,9 @@ struct ComprCUCtx
   double                            bestEmtSize2Nx2N1stPass;
   bool                              skipSecondEMTPass;
   Distortion                        interHad;
+  int                               mergeSatdBin;
+  bool                              mergeSatdSkip;
+  SplitFeatures                     splitFeatures;
 #if ENABLE_SPLIT_PARALLELISM
   bool                              isLevelSplitParallel;
 #endif
@@ -225,6 +235,38 @@ struct ComprCUCtx
   void                      set( int ft, double val ) { extraFeaturesd[ft] = val; }
 };
 
+// online trained decision whether the best merge candidate is good enough to end the mode search of the CU after the
+// merge check: the SATD per sample of the best candidate, relative to sqrt( lambda ), is histogrammed per block size
+// separately for the CUs finally coded in skip mode and for the others, and a CU is predicted to be skip if its SATD
+// falls below the largest bin up to which the CUs not coded as skip stay a small fraction
+class MergeSkipModel
+{
+public:
+  static const int NUM_BINS         = 40;     ///< 4 bins per octave, starting at 1/64
+  static const int NUM_SIZE_CLASSES = 2 * ( MAX_CU_DEPTH - MIN_CU_LOG2 ) + 1;
+  static const int MIN_SKIP_SAMPLES = 64;
+  static const int MAX_MISS_RATE    = 20;     ///< in per mille
+  static const int MAX_SAMPLES      = 1 << 14;
+
+  MergeSkipModel() : m_enabled( false ) {}
+
+  void init         ( bool enabled );
+  bool isEnabled    () const { return m_enabled; }
+
+  static int getBin ( const Distortion satd, const Area& area, const double sqrtLambda );
+
+  bool predictSkip  ( const Area& area, const int bin ) const { return bin < m_threshold[xGetSizeClass( area )]; }
+  void addSample    ( const Area& area, const int bin, const bool isSkip );
+
+private:
+  static int xGetSizeClass( const Area& area ) { return g_aucLog2[area.width] + g_aucLog2[area.height] - 2 * MIN_CU_LOG2; }
+
+  bool     m_enabled;
+  uint32_t m_count    [NUM_SIZE_CLASSES][2][NUM_BINS];
+  uint32_t m_total    [NUM_SIZE_CLASSES];
+  int      m_threshold[NUM_SIZE_CLASSES];     ///< first bin not predicted as skip, 0 while untrained
+};
+
 //////////////////////////////////////////////////////////////////////////
 // EncModeCtrl - abstract class specifying the general flow of mode control
 //////////////////////////////////////////////////////////////////////////
@@ -242,6 +284,8 @@ protected:
   int                   m_lumaQPOffset;
 #endif
   bool                  m_fastDeltaQP;
+  SplitPredictor        m_splitPredictor;
+  MergeSkipModel        m_mergeSkipModel;
   static_vector<ComprCUCtx, ( MAX_CU_DEPTH << 2 )> m_ComprCUCtxList;
 #if ENABLE_SPLIT_PARALLELISM
   int                   m_runNextInParallel;
@@ -280,6 +324,7 @@ public:
   EncTestMode  currTestMode         () const;
   EncTestMode  lastTestMode         () const;
   void         setEarlySkipDetected ();
+  void         setMergeSatd         ( const Area& area, const Distortion satd, const double sqrtLambda );
   virtual void setBest              ( CodingStructure& cs );
   bool         anyMode              () const;
 
@@ -371,6 +416,41 @@ public:
 
 };
 
+// integer motion vectors found by the full ME, kept per luma block position of the picture for the whole
+// multiple-QP loop (DeltaQpRD and MaxDeltaQP)
+// the motion of a block depends on the QP through the MV predictors and the lambda, so a vector of another
+// QP pass is only an approximation and is only used as the start point of the TZ refinement
+// entries are only written by a full search and only handed out to a search at a different QP
+// (the intra SATD costs are shared through the IntraSatdCache of IntraSearch, which only reuses them for
+// unchanged reference samples)
+class CrossQpCache
+{
+private:
+
+  struct MvInfo
+  {
+    int        qp     [NUM_REF_PIC_LIST_01][MAX_STORED_CU_INFO_REFS];
+    bool       validMv[NUM_REF_PIC_LIST_01][MAX_STORED_CU_INFO_REFS];
+    Mv         saveMv [NUM_REF_PIC_LIST_01][MAX_STORED_CU_INFO_REFS];
+  };
+
+  bool                                    m_enabled;
+  std::unordered_map<uint64_t, MvInfo>    m_mvInfo;
+
+  static uint64_t key( const CompArea& area ) { return ( uint64_t( area.x ) << 44 ) | ( uint64_t( area.y ) << 24 ) | ( uint64_t( area.width ) << 12 ) | uint64_t( area.height ); }
+
+public:
+
+  CrossQpCache() : m_enabled( false ) {}
+
+  void init      ( bool enabled ) { m_enabled = enabled; reset(); }
+  bool isEnabled () const         { return m_enabled; }
+  void reset     ();
+
+  bool getMv     ( const CompArea& area, const RefPicList refPicList, const int iRefIdx, const int qp,       Mv& rMv ) const;
+  void setMv     ( const CompArea& area, const RefPicList refPicList, const int iRefIdx, const int qp, const Mv& rMv );
+};
+
 #if REUSE_CU_RESULTS
 struct BestEncodingInfo
 {
@@ -389,7 +469,7 @@ private:
   unsigned            m_numWidths, m_numHeights;
   const Slice        *m_slice_bencinf;
   BestEncodingInfo ***m_bestEncInfo[MAX_CU_SIZE >> MIN_CU_LOG2][MAX_CU_SIZE >> MIN_CU_LOG2];
-  TCoeff             *m_pCoeff;
+  TCoeffLevel        *m_pCoeff;
   Pel                *m_pPcmBuf;
   CodingStructure     m_dummyCS;
   XUCache             m_dummyCache;
@@ -0,0 +1,254 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2018, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     EncMotionFieldCache.cpp
+    \brief    motion field of coded pictures kept for seeding the motion estimation
+*/
+
+#include "EncMotionFieldCache.h"
+
+#include "CommonLib/CodingStructure.h"
+#include "CommonLib/Picture.h"
+#include "CommonLib/Slice.h"
+
+#include <algorithm>
+
+//! \ingroup EncoderLib
+//! \{
+
+static int xGetDistScaleFactor( const int iCurrPOC, const int iCurrRefPOC, const int iColPOC, const int iColRefPOC )
+{
+  const int iDiffPocD = iColPOC  - iColRefPOC;
+  const int iDiffPocB = iCurrPOC - iCurrRefPOC;
+
+  if( iDiffPocD == iDiffPocB )
+  {
+    return 4096;
+  }
+
+  const int iTDB = Clip3( -128, 127, iDiffPocB );
+  const int iTDD = Clip3( -128, 127, iDiffPocD );
+  const int iX   = ( 0x4000 + abs( iTDD / 2 ) ) / iTDD;
+
+  return Clip3( -4096, 4095, ( iTDB * iX + 32 ) >> 6 );
+}
+
+void MotionFieldCache::init( bool enabled, int maxNumFields )
+{
+  m_enabled      = enabled;
+  m_maxNumFields = std::max( 1, maxNumFields );
+  m_fields.clear();
+}
+
+const MotionFieldCache::Field* MotionFieldCache::getField( const int poc ) const
+{
+  for( auto it = m_fields.rbegin(); it != m_fields.rend(); it++ )
+  {
+    if( it->poc == poc )
+    {
+      return &*it;
+    }
+  }
+
+  return nullptr;
+}
+
+void MotionFieldCache::store( const Picture& pic )
+{
+  const CodingStructure& cs = *pic.cs;
+
+  // a re-encoded picture replaces its previous field
+  for( auto it = m_fields.begin(); it != m_fields.end(); it++ )
+  {
+    if( it->poc == pic.getPOC() )
+    {
+      m_fields.erase( it );
+      break;
+    }
+  }
+
+  if( (int) m_fields.size() >= m_maxNumFields )
+  {
+    m_fields.pop_front();
+  }
+
+  m_fields.push_back( Field() );
+
+  Field& field  = m_fields.back();
+  field.poc     = pic.getPOC();
+  field.tLayer  = pic.slices[0]->getTLayer();
+  field.width   = ( pic.lwidth()  + ( 1 << LOG2_CELL_SIZE ) - 1 ) >> LOG2_CELL_SIZE;
+  field.height  = ( pic.lheight() + ( 1 << LOG2_CELL_SIZE ) - 1 ) >> LOG2_CELL_SIZE;
+  field.cells.resize( field.width * field.height );
+
+  for( int y = 0; y < field.height; y++ )
+  {
+    for( int x = 0; x < field.width; x++ )
+    {
+      Cell& cell = field.cells[y * field.width + x];
+
+      cell.valid[REF_PIC_LIST_0] = cell.valid[REF_PIC_LIST_1] = false;
+
+      const MotionInfo& mi = cs.getMotionInfo( Position( x << LOG2_CELL_SIZE, y << LOG2_CELL_SIZE ) );
+
+      if( !mi.isInter )
+      {
+        continue;
+      }
+
+      const Slice* slice = nullptr;
+
+      for( const auto s : pic.slices )
+      {
+        if( s->getIndependentSliceIdx() == mi.sliceIdx )
+        {
+          slice = s;
+          break;
+        }
+      }
+
+      if( !slice )
+      {
+        continue;
+      }
+
+      for( int l = 0; l < NUM_REF_PIC_LIST_01; l++ )
+      {
+        const RefPicList eRefPicList = RefPicList( l );
+
+        if( mi.refIdx[l] < 0 || slice->getIsUsedAsLongTerm( eRefPicList, mi.refIdx[l] ) )
+        {
+          continue;
+        }
+
+        Mv mv = mi.mv[l];
+#if REMOVE_MV_ADAPT_PREC
+        const int nShift  = VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE;
+        const int nOffset = 1 << ( nShift - 1 );
+        mv.hor = mv.hor >= 0 ? ( mv.hor + nOffset ) >> nShift : -( ( -mv.hor + nOffset ) >> nShift );
+        mv.ver = mv.ver >= 0 ? ( mv.ver + nOffset ) >> nShift : -( ( -mv.ver + nOffset ) >> nShift );
+#else
+        if( mv.highPrec )
+        {
+          mv.roundMV2SignalPrecision();
+        }
+#endif
+
+        cell.valid [l] = true;
+        cell.refPoc[l] = slice->getRefPOC( eRefPicList, mi.refIdx[l] );
+        cell.mv    [l] = mv;
+      }
+    }
+  }
+}
+
+void MotionFieldCache::getSeeds( const PredictionUnit& pu, const RefPicList eRefPicList, const int iRefIdx, Seeds& seeds ) const
+{
+  seeds.clear();
+
+  const Slice&   slice  = *pu.cs->slice;
+  const Picture* refPic = slice.getRefPic( eRefPicList, iRefIdx );
+
+  if( refPic->longTerm )
+  {
+    return;
+  }
+
+  const int currPOC    = slice.getPOC();
+  const int currRefPOC = refPic->getPOC();
+
+  // the reference pictures of the slice in list order, followed by the last picture of the same temporal layer
+  static_vector<const Field*, 2 * MAX_NUM_REF + 1> fields;
+
+  for( int l = 0; l < ( slice.isInterB() ? 2 : 1 ); l++ )
+  {
+    for( int i = 0; i < slice.getNumRefIdx( RefPicList( l ) ); i++ )
+    {
+      const Field* field = getField( slice.getRefPOC( RefPicList( l ), i ) );
+
+      if( field && std::find( fields.begin(), fields.end(), field ) == fields.end() )
+      {
+        fields.push_back( field );
+      }
+    }
+  }
+
+  for( auto it = m_fields.rbegin(); it != m_fields.rend(); it++ )
+  {
+    if( it->tLayer == slice.getTLayer() && it->poc != currPOC )
+    {
+      if( std::find( fields.begin(), fields.end(), &*it ) == fields.end() )
+      {
+        fields.push_back( &*it );
+      }
+      break;
+    }
+  }
+
+  const Position center = pu.Y().center();
+
+  for( const Field* field : fields )
+  {
+    const int x = std::min( center.x >> LOG2_CELL_SIZE, field->width  - 1 );
+    const int y = std::min( center.y >> LOG2_CELL_SIZE, field->height - 1 );
+
+    const Cell& cell = field->cells[y * field->width + x];
+
+    for( int l = 0; l < NUM_REF_PIC_LIST_01; l++ )
+    {
+      if( !cell.valid[l] || cell.refPoc[l] == field->poc )
+      {
+        continue;
+      }
+
+      const int scale = xGetDistScaleFactor( currPOC, currRefPOC, field->poc, cell.refPoc[l] );
+      Mv        seed  = scale == 4096 ? cell.mv[l] : cell.mv[l].scaleMv( scale );
+
+      // integer-pel start point
+      seed.hor = ( seed.hor + 2 ) >> 2 << 2;
+      seed.ver = ( seed.ver + 2 ) >> 2 << 2;
+
+      if( std::find( seeds.begin(), seeds.end(), seed ) == seeds.end() )
+      {
+        seeds.push_back( seed );
+
+        if( seeds.size() == MAX_NUM_SEEDS )
+        {
+          return;
+        }
+      }
+    }
+  }
+}
+
+//! \}
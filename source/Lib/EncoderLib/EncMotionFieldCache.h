@@ -0,0 +1,103 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2018, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     EncMotionFieldCache.h
+    \brief    motion field of coded pictures kept for seeding the motion estimation (header)
+*/
+
+#ifndef __ENCMOTIONFIELDCACHE__
+#define __ENCMOTIONFIELDCACHE__
+
+#include "CommonLib/CommonDef.h"
+#include "CommonLib/Mv.h"
+#include "CommonLib/Unit.h"
+
+#include <deque>
+#include <vector>
+
+//! \ingroup EncoderLib
+//! \{
+
+class Picture;
+
+// ====================================================================================================================
+// Class definition
+// ====================================================================================================================
+
+/// motion of already coded pictures, indexed by POC, used to derive temporally scaled start points for the TZ search
+class MotionFieldCache
+{
+public:
+  static const int LOG2_CELL_SIZE   = 3;
+  static const int MAX_NUM_SEEDS    = 4;
+
+  typedef static_vector<Mv, MAX_NUM_SEEDS> Seeds;
+
+  MotionFieldCache() : m_enabled( false ), m_maxNumFields( 0 ) {}
+
+  void init         ( bool enabled, int maxNumFields );
+  bool isEnabled    () const { return m_enabled; }
+
+  /// keeps the coded motion of the picture once all its slices have been compressed
+  void store        ( const Picture& pic );
+  /// collects integer-pel (1/4 sample units) start points for the ME of the PU from the motion of the reference
+  /// pictures and of the last picture of the same temporal layer, scaled to the distance of the searched reference
+  void getSeeds     ( const PredictionUnit& pu, const RefPicList eRefPicList, const int iRefIdx, Seeds& seeds ) const;
+
+private:
+  struct Cell
+  {
+    bool valid [NUM_REF_PIC_LIST_01];
+    int  refPoc[NUM_REF_PIC_LIST_01];
+    Mv   mv    [NUM_REF_PIC_LIST_01];   ///< in 1/4 sample units
+  };
+
+  struct Field
+  {
+    int               poc;
+    int               tLayer;
+    int               width;            ///< in cells
+    int               height;           ///< in cells
+    std::vector<Cell> cells;
+  };
+
+  const Field* getField ( const int poc ) const;
+
+  bool              m_enabled;
+  int               m_maxNumFields;
+  std::deque<Field> m_fields;           ///< in coding order, the most recent last
+};
+
+//! \}
+
+#endif // __ENCMOTIONFIELDCACHE__
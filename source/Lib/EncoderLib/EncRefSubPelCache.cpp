@@ -0,0 +1,408 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2018, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     EncRefSubPelCache.cpp
+    \brief    half-sample interpolated planes of the reference pictures shared by the motion estimation
+*/
+
+#include "EncRefSubPelCache.h"
+
+#include "CommonLib/Picture.h"
+#include "CommonLib/Slice.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined( _MSC_VER )
+#include <xmmintrin.h>
+#define PREFETCH_L2( p )  _mm_prefetch( (const char*) ( p ), _MM_HINT_T1 )
+#elif defined( __GNUC__ )
+#define PREFETCH_L2( p )  __builtin_prefetch( ( p ), 0, 2 )
+#else
+#define PREFETCH_L2( p )
+#endif
+
+//! \ingroup EncoderLib
+//! \{
+
+static const int PREFETCH_LINE_SAMPLES = 64 / sizeof( Pel );
+
+typedef static_vector<const Picture*, 2 * MAX_NUM_REF> RefPics;
+
+static void xGetRefPics( const Slice& slice, RefPics& refPics )
+{
+  refPics.clear();
+
+  for( int l = 0; l < NUM_REF_PIC_LIST_01; l++ )
+  {
+    for( int i = 0; i < slice.getNumRefIdx( RefPicList( l ) ); i++ )
+    {
+      const Picture* refPic = slice.getRefPic( RefPicList( l ), i );
+
+      // long-term pictures may be a background picture that is updated in place
+      if( refPic && !refPic->longTerm && std::find( refPics.begin(), refPics.end(), refPic ) == refPics.end() )
+      {
+        refPics.push_back( refPic );
+      }
+    }
+  }
+}
+
+void RefSubPelCache::init( int mode, int tileSize )
+{
+  destroy();
+
+  m_mode     = mode;
+  m_tileSize = tileSize;
+
+  if( isEnabled() )
+  {
+    m_if.initInterpolationFilter( true );
+    m_tmp.resize( m_tileSize * ( m_tileSize + NTAPS_LUMA - 1 ) );
+  }
+}
+
+void RefSubPelCache::destroy()
+{
+  m_planes.clear();
+  m_tmp.clear();
+
+  m_numAccesses = m_numHits = m_numBypassed = m_numPrecomputed = 0;
+}
+
+RefSubPelCache::Planes* RefSubPelCache::xGetPlanes( const Picture& pic )
+{
+  for( auto& planes : m_planes )
+  {
+    if( planes.pic == &pic && planes.poc == pic.getPOC() )
+    {
+      return &planes;
+    }
+  }
+
+  return nullptr;
+}
+
+void RefSubPelCache::xRelease()
+{
+  // the picture buffer may also have been reused for another picture
+  for( auto& planes : m_planes )
+  {
+    if( planes.pic && ( !planes.pic->referenced || planes.pic->longTerm || planes.pic->getPOC() != planes.poc ) )
+    {
+      planes.pic = nullptr;
+    }
+  }
+}
+
+RefSubPelCache::Planes& RefSubPelCache::xBind( const Picture& pic )
+{
+  auto free = std::find_if( m_planes.begin(), m_planes.end(), []( const Planes& p ) { return p.pic == nullptr; } );
+
+  if( free == m_planes.end() )
+  {
+    m_planes.push_back( Planes() );
+    free = m_planes.end() - 1;
+  }
+
+  Planes& planes = *free;
+
+  // keep clear of the outermost padded samples so that the filter taps of a tile never leave the padded picture
+  const int border = NTAPS_LUMA - ( int ) pic.margin;
+
+  planes.pic         = &pic;
+  planes.poc         = pic.getPOC();
+  planes.origin      = border;
+  planes.width       = ( int ) pic.lwidth()  - 2 * border;
+  planes.height      = ( int ) pic.lheight() - 2 * border;
+  planes.tilesPerRow = ( planes.width + m_tileSize - 1 ) / m_tileSize;
+
+  const int tilesPerCol = ( planes.height + m_tileSize - 1 ) / m_tileSize;
+  const int planeSize   = planes.width * planes.height;
+
+  for( int fy = 0; fy < 4; fy++ )
+  {
+    for( int fx = 0; fx < 4; fx++ )
+    {
+      const bool used = ( fx | fy ) != 0 && ( hasAllPhases() || ( fy == 2 && ( fx == 0 || fx == 2 ) ) );
+
+      planes.phase[fy][fx].resize( used ? planeSize : 0 );
+    }
+  }
+
+  planes.horInt.resize( hasAllPhases() ? 0 : planeSize );
+  planes.tileValid.assign( planes.tilesPerRow * tilesPerCol, 0 );
+
+  return planes;
+}
+
+void RefSubPelCache::initSlice( const Slice& slice )
+{
+  if( !isEnabled() )
+  {
+    return;
+  }
+
+  m_clpRng = slice.clpRng( COMPONENT_Y );
+
+  xRelease();
+
+  RefPics refPics;
+  xGetRefPics( slice, refPics );
+
+  for( const Picture* refPic : refPics )
+  {
+    if( !xGetPlanes( *refPic ) )
+    {
+      Planes& planes = xBind( *refPic );
+
+      if( m_mode != HALF_ON_USE )
+      {
+        xPrecompute( planes );
+      }
+    }
+  }
+}
+
+void RefSubPelCache::xPrecompute( Planes& planes )
+{
+  const int tilesPerCol = ( int ) planes.tileValid.size() / planes.tilesPerRow;
+
+  m_numPrecomputed += planes.tileValid.size();
+
+  // the tiles are independent, each tile row gets its own intermediate buffer
+#pragma omp parallel for schedule(dynamic,1)
+  for( int tileY = 0; tileY < tilesPerCol; tileY++ )
+  {
+    std::vector<Pel> tmp( m_tmp.size() );
+
+    for( int tileX = 0; tileX < planes.tilesPerRow; tileX++ )
+    {
+      xFillTile( planes, tileX, tileY, &tmp[0] );
+    }
+  }
+}
+
+void RefSubPelCache::xFillTile( Planes& planes, const int tileX, const int tileY, Pel* tmp )
+{
+  const int          px     = tileX * m_tileSize;
+  const int          py     = tileY * m_tileSize;
+  const int          width  = std::min( m_tileSize, planes.width  - px );
+  const int          height = std::min( m_tileSize, planes.height - py );
+  const int          stride = planes.width;
+  const ChromaFormat chFmt  = planes.pic->chromaFormat;
+  const CPelBuf      reco   = planes.pic->getRecoBuf( COMPONENT_Y );
+  const int          above  = ( NTAPS_LUMA >> 1 ) - 1;
+
+  // the intermediate rows start above the tile by the vertical filter support
+  const Pel* src    = reco.buf + ( py + planes.origin - above ) * reco.stride + px + planes.origin;
+  const Pel* tmpPos = tmp + above * m_tileSize;
+
+  for( int fx = 0; fx < 4; fx++ )
+  {
+    if( !hasAllPhases() && fx != 0 && fx != 2 )
+    {
+      continue;
+    }
+
+    m_if.filterHor( COMPONENT_Y, src, reco.stride, tmp, m_tileSize, width, height + NTAPS_LUMA - 1, fx << VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE, false, chFmt, m_clpRng );
+
+    if( !hasAllPhases() && fx == 2 )
+    {
+      for( int y = 0; y < height; y++ )
+      {
+        std::memcpy( &planes.horInt[( py + y ) * stride + px], tmpPos + y * m_tileSize, width * sizeof( Pel ) );
+      }
+    }
+
+    for( int fy = 0; fy < 4; fy++ )
+    {
+      if( planes.phase[fy][fx].empty() )
+      {
+        continue;
+      }
+
+      m_if.filterVer( COMPONENT_Y, tmpPos, m_tileSize, &planes.phase[fy][fx][py * stride + px], stride, width, height, fy << VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE, false, true, chFmt, m_clpRng );
+    }
+  }
+
+  planes.tileValid[tileY * planes.tilesPerRow + tileX] = 1;
+}
+
+bool RefSubPelCache::xFetchTiles( Planes& planes, const int x0, const int y0, const int x1, const int y1 )
+{
+  if( x0 < 0 || y0 < 0 || x1 > planes.width || y1 > planes.height )
+  {
+    m_numBypassed++;
+    return false;
+  }
+
+  for( int tileY = y0 / m_tileSize; tileY <= ( y1 - 1 ) / m_tileSize; tileY++ )
+  {
+    for( int tileX = x0 / m_tileSize; tileX <= ( x1 - 1 ) / m_tileSize; tileX++ )
+    {
+      m_numAccesses++;
+
+      if( planes.tileValid[tileY * planes.tilesPerRow + tileX] )
+      {
+        m_numHits++;
+      }
+      else
+      {
+        xFillTile( planes, tileX, tileY, &m_tmp[0] );
+      }
+    }
+  }
+
+  return true;
+}
+
+bool RefSubPelCache::getHalfPel( const Picture& refPic, const Position& pos, const Size& size, Pel* hor, Pel* ver, Pel* horVer, const int stride )
+{
+  Planes* planes = xGetPlanes( refPic );
+
+  if( !planes || hasAllPhases() )
+  {
+    m_numBypassed++;
+    return false;
+  }
+
+  const int half   = NTAPS_LUMA >> 1;
+  const int width  = size.width;
+  const int height = size.height;
+  const int x0     = pos.x - planes->origin - 1;
+  const int y0     = pos.y - planes->origin - half;
+
+  // the intermediate plane covers the others
+  if( !xFetchTiles( *planes, x0, y0, x0 + width + 1, y0 + height + NTAPS_LUMA ) )
+  {
+    return false;
+  }
+
+  const int planeStride = planes->width;
+
+  for( int y = 0; y < height + NTAPS_LUMA; y++ )
+  {
+    std::memcpy( hor + y * stride, &planes->horInt[( y0 + y ) * planeStride + x0], ( width + 1 ) * sizeof( Pel ) );
+  }
+
+  for( int y = 0; y < height + 1; y++ )
+  {
+    std::memcpy( ver    + y * stride, &planes->phase[2][0][( y0 + half - 1 + y ) * planeStride + x0 + 1], ( width + 0 ) * sizeof( Pel ) );
+    std::memcpy( horVer + y * stride, &planes->phase[2][2][( y0 + half - 1 + y ) * planeStride + x0    ], ( width + 1 ) * sizeof( Pel ) );
+  }
+
+  return true;
+}
+
+bool RefSubPelCache::getPhases( const Picture& refPic, const Position& pos, const Size& size, PhaseBufs& bufs )
+{
+  Planes* planes = xGetPlanes( refPic );
+
+  if( !planes || !hasAllPhases() )
+  {
+    m_numBypassed++;
+    return false;
+  }
+
+  const int x0 = pos.x - planes->origin;
+  const int y0 = pos.y - planes->origin;
+
+  if( !xFetchTiles( *planes, x0 - 1, y0 - 1, x0 + size.width, y0 + size.height ) )
+  {
+    return false;
+  }
+
+  const CPelBuf reco = refPic.getRecoBuf( COMPONENT_Y );
+
+  for( int fy = 0; fy < 4; fy++ )
+  {
+    for( int fx = 0; fx < 4; fx++ )
+    {
+      if( ( fx | fy ) == 0 )
+      {
+        bufs.buf   [0][0] = reco.bufAt( pos );
+        bufs.stride[0][0] = reco.stride;
+      }
+      else
+      {
+        bufs.buf   [fy][fx] = &planes->phase[fy][fx][y0 * planes->width + x0];
+        bufs.stride[fy][fx] = planes->width;
+      }
+    }
+  }
+
+  return true;
+}
+
+void RefSubPelCache::prefetchCtu( const Slice& slice, const Area& ctuArea ) const
+{
+  RefPics refPics;
+  xGetRefPics( slice, refPics );
+
+  for( const Picture* refPic : refPics )
+  {
+    const CPelBuf reco   = refPic->getRecoBuf( COMPONENT_Y );
+    const int     margin = ( int ) refPic->margin;
+    const int     xStart = std::max( ctuArea.x - PREFETCH_MARGIN, -margin );
+    const int     xEnd   = std::min( ctuArea.x + ( int ) ctuArea.width  + PREFETCH_MARGIN, ( int ) refPic->lwidth()  + margin );
+    const int     yStart = std::max( ctuArea.y - PREFETCH_MARGIN, -margin );
+    const int     yEnd   = std::min( ctuArea.y + ( int ) ctuArea.height + PREFETCH_MARGIN, ( int ) refPic->lheight() + margin );
+
+    for( int y = yStart; y < yEnd; y++ )
+    {
+      const Pel* line = reco.buf + y * reco.stride;
+
+      for( int x = xStart; x < xEnd; x += PREFETCH_LINE_SAMPLES )
+      {
+        PREFETCH_L2( line + x );
+      }
+
+      PREFETCH_L2( line + xEnd - 1 );
+    }
+  }
+}
+
+void RefSubPelCache::report() const
+{
+  if( !isEnabled() || m_numAccesses == 0 )
+  {
+    return;
+  }
+
+  msg( INFO, "\nReference sub-pel cache\n" );
+  msg( INFO, "Hit ratio %5.2f [%%]\n", ( 100 * ( double ) m_numHits ) / m_numAccesses );
+  msg( INFO, "Precomputed tiles %llu, tiles interpolated on use %llu, blocks interpolated without the cache %llu\n", ( unsigned long long ) m_numPrecomputed, ( unsigned long long ) ( m_numAccesses - m_numHits ), ( unsigned long long ) m_numBypassed );
+}
+
+//! \}
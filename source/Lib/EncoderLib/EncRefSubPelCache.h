@@ -0,0 +1,138 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2018, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     EncRefSubPelCache.h
+    \brief    sub-sample interpolated planes of the reference pictures shared by the motion estimation (header)
+*/
+
+#ifndef __ENCREFSUBPELCACHE__
+#define __ENCREFSUBPELCACHE__
+
+#include "CommonLib/CommonDef.h"
+#include "CommonLib/InterpolationFilter.h"
+#include "CommonLib/Unit.h"
+
+#include <vector>
+
+//! \ingroup EncoderLib
+//! \{
+
+class Picture;
+class Slice;
+
+// ====================================================================================================================
+// Class definition
+// ====================================================================================================================
+
+/// sub-sample luma planes of the reference pictures, kept as long as the pictures are marked as referenced, so that
+/// the fractional ME of overlapping blocks, of the different CU sizes and of later pictures reuses the interpolation
+class RefSubPelCache
+{
+public:
+  enum Mode
+  {
+    OFF          = 0,
+    HALF_ON_USE  = 1,                   ///< half-sample planes, filled per tile on first use
+    HALF         = 2,                   ///< half-sample planes, filled when the picture is first referenced
+    FULL         = 3,                   ///< all 15 fractional phases, filled when the picture is first referenced
+  };
+
+  static const int PREFETCH_MARGIN  = 8;
+
+  /// samples of every phase at an integer position, [ver. phase][hor. phase], [0][0] being the reconstruction
+  struct PhaseBufs
+  {
+    const Pel* buf   [4][4];
+    int        stride[4][4];
+  };
+
+  RefSubPelCache() : m_mode( OFF ), m_tileSize( 0 ), m_numAccesses( 0 ), m_numHits( 0 ), m_numBypassed( 0 ), m_numPrecomputed( 0 ) {}
+
+  void init         ( int mode, int tileSize );
+  void destroy      ();
+  bool isEnabled    () const { return m_mode != OFF; }
+  bool hasAllPhases () const { return m_mode == FULL; }
+
+  /// binds planes to the short-term reference pictures of the slice, releasing those of pictures no longer referenced,
+  /// and fills the planes of newly bound pictures in the precomputing modes
+  void initSlice    ( const Slice& slice );
+  /// issues software prefetches for the reference luma samples around the co-located area of the CTU
+  void prefetchCtu  ( const Slice& slice, const Area& ctuArea ) const;
+  /// copies the half-sample samples needed by the half-pel refinement of a block at the integer position pos, laid out
+  /// as InterSearch::xExtDIFUpSamplingH produces them: hor is the intermediate horizontal plane of (w+1)x(h+8) samples
+  /// starting 4 rows above, ver is w x (h+1) and horVer is (w+1)x(h+1), all with the given stride. Returns false when
+  /// the reference is not bound or the block is too close to the padded picture border.
+  bool getHalfPel   ( const Picture& refPic, const Position& pos, const Size& size, Pel* hor, Pel* ver, Pel* horVer, const int stride );
+  /// points to the samples of all phases at the integer position pos, in FULL mode only. The refinement may read one
+  /// sample above and left of the block. Returns false as getHalfPel.
+  bool getPhases    ( const Picture& refPic, const Position& pos, const Size& size, PhaseBufs& bufs );
+
+  void report       () const;
+
+private:
+  struct Planes
+  {
+    const Picture*       pic;
+    int                  poc;
+    int                  origin;        ///< position of the first plane sample relative to the picture, both directions
+    int                  width;
+    int                  height;
+    int                  tilesPerRow;
+    std::vector<Pel>     horInt;        ///< (x+1/2,y) before the vertical filter stage, half-sample modes only
+    std::vector<Pel>     phase[4][4];   ///< (x+fx/4,y+fy/4) at [fy][fx], only [2][0] and [2][2] in the half-sample modes
+    std::vector<uint8_t> tileValid;
+  };
+
+  Planes* xGetPlanes  ( const Picture& pic );
+  void    xRelease    ();
+  Planes& xBind       ( const Picture& pic );
+  void    xPrecompute ( Planes& planes );
+  bool    xFetchTiles ( Planes& planes, const int x0, const int y0, const int x1, const int y1 );
+  void    xFillTile   ( Planes& planes, const int tileX, const int tileY, Pel* tmp );
+
+  int                  m_mode;
+  int                  m_tileSize;
+  ClpRng               m_clpRng;
+  InterpolationFilter  m_if;
+  std::vector<Pel>     m_tmp;
+  std::vector<Planes>  m_planes;
+
+  uint64_t             m_numAccesses;   ///< tiles looked up
+  uint64_t             m_numHits;       ///< tiles already interpolated
+  uint64_t             m_numBypassed;   ///< blocks left to the regular interpolation
+  uint64_t             m_numPrecomputed;///< tiles filled when binding a picture
+};
+
+//! \}
+
+#endif // __ENCREFSUBPELCACHE__
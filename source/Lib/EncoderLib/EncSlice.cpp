@@ -88,6 +88,7 @@ void EncSlice::init( EncLib* pcEncLib, const SPS& sps )
   m_pcCfg             = pcEncLib;
   m_pcLib             = pcEncLib;
   m_pcListPic         = pcEncLib->getListPic();
+  setGlobalMotion( pcEncLib->getGlobalMotion()->isEnabled() ? pcEncLib->getGlobalMotion() : nullptr );
 
   m_pcGOPEncoder      = pcEncLib->getGOPEncoder();
   m_pcCuEncoder       = pcEncLib->getCuEncoder();
@@ -1007,6 +1008,18 @@ void EncSlice::setSearchRange( Slice* pcSlice )
  */
 void EncSlice::precompressSlice( Picture* pcPic )
 {
+  // the analysis kept across QPs is only valid for the current slice
+  if( m_pcCfg->getUseCrossQpReuse() )
+  {
+    m_pcCuEncoder->getCrossQpCache().reset();
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
+    for( int jId = 1; jId < m_pcLib->getNumCuEncStacks(); jId++ )
+    {
+      m_pcLib->getCuEncoder( jId )->getCrossQpCache().reset();
+    }
+#endif
+  }
+
   // if deltaQP RD is not used, simply return
   if ( m_pcCfg->getDeltaQpRD() == 0 )
   {
@@ -1231,6 +1244,12 @@ void EncSlice::compressSlice( Picture* pcPic, const bool bCompressEntireSlice, c
     }
   }
 
+  // global motion of the picture, its pass over the original samples also provides the histograms for the WP analysis
+  if( m_pcLib->getGlobalMotion()->isEnabled() )
+  {
+    m_pcLib->getGlobalMotion()->analyse( *pcSlice );
+  }
+
   //------------------------------------------------------------------------------
   //  Weighted Prediction parameters estimation.
   //------------------------------------------------------------------------------
@@ -1406,6 +1425,8 @@ void EncSlice::compressSlice( Picture* pcPic, const bool bCompressEntireSlice, c
   cs.pcv      = pcSlice->getPPS()->pcv;
   cs.fracBits = 0;
 
+  m_pcLib->getRefSubPelCache()->initSlice( *pcSlice );
+
 
 #if ENABLE_WPP_PARALLELISM
   bool bUseThreads = m_pcCfg->getNumWppThreads() > 1;
@@ -1617,6 +1638,11 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
 
 
 
+    if( pEncLib->getRefSubPelCache()->isEnabled() )
+    {
+      pEncLib->getRefSubPelCache()->prefetchCtu( *pcSlice, ctuArea.Y() );
+    }
+
 #if ENABLE_WPP_PARALLELISM
     pEncLib->getCuEncoder( dataId )->compressCtu( cs, ctuArea, ctuRsAddr, prevQP, currQP );
 #else
@@ -0,0 +1,649 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2018, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     EncSplitPredictor.cpp
+    \brief    learned CU split decision predictor
+*/
+
+#include "EncSplitPredictor.h"
+
+#include "EncCfg.h"
+
+#include "CommonLib/CodingStructure.h"
+#include "CommonLib/RdCost.h"
+
+#include <cmath>
+
+//! \ingroup EncoderLib
+//! \{
+
+// ====================================================================================================================
+// Decision forest
+// ====================================================================================================================
+
+// Node of a binary decision tree. Inner nodes continue with "left" if f[feature] <= threshold and with "right"
+// otherwise, leaves (feature < 0) store the index of their class distribution in "left".
+struct SplitPredNode
+{
+  int8_t   feature;
+  int16_t  threshold;
+  uint16_t left;
+  uint16_t right;
+};
+
+// The tables below are generated by source/App/utils/SplitPredictor/train_split_predictor.py from the samples
+// written with SplitPredictorDumpFile.
+//TABLES_BEGIN
+// 200000 samples, area weighted class histogram [1341187, 9680, 41530, 40992, 18908, 20772]
+static constexpr int NUM_SPLIT_PRED_TREES = 4;
+
+static constexpr uint16_t g_splitPredRoots[NUM_SPLIT_PRED_TREES] = { 0, 61, 126, 181 };
+
+static constexpr SplitPredNode g_splitPredNodes[] =
+{
+  {  3,    2,    1,   60 },
+  { 12,    0,    2,   29 },
+  { 13,    0,    3,   26 },
+  {  4,   31,    4,   13 },
+  {  9,   27,    5,   10 },
+  {  6,   79,    6,    9 },
+  { 10,   44,    7,    8 },
+  { -1,    0,    0,    0 },
+  { -1,    0,    1,    0 },
+  { -1,    0,    2,    0 },
+  { 10,   20,   11,   12 },
+  { -1,    0,    3,    0 },
+  { -1,    0,    4,    0 },
+  { 10,   20,   14,   21 },
+  { 10,    2,   15,   18 },
+  { 10,    1,   16,   17 },
+  { -1,    0,    5,    0 },
+  { -1,    0,    6,    0 },
+  {  9,   27,   19,   20 },
+  { -1,    0,    7,    0 },
+  { -1,    0,    8,    0 },
+  {  8,   16,   22,   23 },
+  { -1,    0,    9,    0 },
+  {  9,   28,   24,   25 },
+  { -1,    0,   10,    0 },
+  { -1,    0,   11,    0 },
+  {  4,   31,   27,   28 },
+  { -1,    0,   12,    0 },
+  { -1,    0,   13,    0 },
+  { 13,    1,   30,   53 },
+  {  5,    0,   31,   40 },
+  { 10,   42,   32,   35 },
+  {  9,   30,   33,   34 },
+  { -1,    0,   14,    0 },
+  { -1,    0,   15,    0 },
+  {  1,    4,   36,   39 },
+  {  0,    3,   37,   38 },
+  { -1,    0,   16,    0 },
+  { -1,    0,   17,    0 },
+  { -1,    0,   18,    0 },
+  { 13,    0,   41,   48 },
+  {  0,    2,   42,   45 },
+  {  1,    2,   43,   44 },
+  { -1,    0,   19,    0 },
+  { -1,    0,   20,    0 },
+  { 10,   49,   46,   47 },
+  { -1,    0,   21,    0 },
+  { -1,    0,   22,    0 },
+  {  3,    1,   49,   50 },
+  { -1,    0,   23,    0 },
+  {  8,   20,   51,   52 },
+  { -1,    0,   24,    0 },
+  { -1,    0,   25,    0 },
+  {  1,    4,   54,   59 },
+  {  8,   25,   55,   56 },
+  { -1,    0,   26,    0 },
+  {  9,   41,   57,   58 },
+  { -1,    0,   27,    0 },
+  { -1,    0,   28,    0 },
+  { -1,    0,   29,    0 },
+  { -1,    0,   30,    0 },
+  {  3,    2,   62,  125 },
+  { 12,    0,   63,   92 },
+  {  4,   31,   64,   79 },
+  {  9,   27,   65,   74 },
+  {  6,   80,   66,   71 },
+  { 10,   44,   67,   70 },
+  {  6,   57,   68,   69 },
+  { -1,    0,   31,    0 },
+  { -1,    0,   32,    0 },
+  { -1,    0,   33,    0 },
+  { 10,   10,   72,   73 },
+  { -1,    0,   34,    0 },
+  { -1,    0,   35,    0 },
+  {  2,    0,   75,   76 },
+  { -1,    0,   36,    0 },
+  { 13,   -2,   77,   78 },
+  { -1,    0,   37,    0 },
+  { -1,    0,   38,    0 },
+  { 13,    0,   80,   91 },
+  { 10,   20,   81,   86 },
+  { 10,    2,   82,   83 },
+  { -1,    0,   39,    0 },
+  {  9,   27,   84,   85 },
+  { -1,    0,   40,    0 },
+  { -1,    0,   41,    0 },
+  {  7,   20,   87,   88 },
+  { -1,    0,   42,    0 },
+  {  9,   29,   89,   90 },
+  { -1,    0,   43,    0 },
+  { -1,    0,   44,    0 },
+  { -1,    0,   45,    0 },
+  { 13,    1,   93,  118 },
+  {  5,    0,   94,  103 },
+  { 10,   42,   95,   98 },
+  {  9,   30,   96,   97 },
+  { -1,    0,   46,    0 },
+  { -1,    0,   47,    0 },
+  {  1,    4,   99,  102 },
+  {  7,   35,  100,  101 },
+  { -1,    0,   48,    0 },
+  { -1,    0,   49,    0 },
+  { -1,    0,   50,    0 },
+  { 13,    0,  104,  111 },
+  {  0,    2,  105,  108 },
+  {  1,    2,  106,  107 },
+  { -1,    0,   51,    0 },
+  { -1,    0,   52,    0 },
+  {  1,    3,  109,  110 },
+  { -1,    0,   53,    0 },
+  { -1,    0,   54,    0 },
+  { 10,   51,  112,  115 },
+  {  8,   21,  113,  114 },
+  { -1,    0,   55,    0 },
+  { -1,    0,   56,    0 },
+  {  9,   37,  116,  117 },
+  { -1,    0,   57,    0 },
+  { -1,    0,   58,    0 },
+  {  1,    4,  119,  124 },
+  {  8,   25,  120,  121 },
+  { -1,    0,   59,    0 },
+  {  8,   31,  122,  123 },
+  { -1,    0,   60,    0 },
+  { -1,    0,   61,    0 },
+  { -1,    0,   62,    0 },
+  { -1,    0,   63,    0 },
+  {  3,    2,  127,  180 },
+  { 12,    0,  128,  145 },
+  { 13,    0,  129,  142 },
+  {  9,   37,  130,  141 },
+  { 10,   45,  131,  138 },
+  {  4,   31,  132,  135 },
+  {  9,   27,  133,  134 },
+  { -1,    0,   64,    0 },
+  { -1,    0,   65,    0 },
+  { 11,    0,  136,  137 },
+  { -1,    0,   66,    0 },
+  { -1,    0,   67,    0 },
+  {  6,   60,  139,  140 },
+  { -1,    0,   68,    0 },
+  { -1,    0,   69,    0 },
+  { -1,    0,   70,    0 },
+  {  9,   27,  143,  144 },
+  { -1,    0,   71,    0 },
+  { -1,    0,   72,    0 },
+  { 13,    1,  146,  173 },
+  {  1,    3,  147,  160 },
+  {  0,    3,  148,  155 },
+  {  0,    2,  149,  152 },
+  {  1,    2,  150,  151 },
+  { -1,    0,   73,    0 },
+  { -1,    0,   74,    0 },
+  {  6,   82,  153,  154 },
+  { -1,    0,   75,    0 },
+  { -1,    0,   76,    0 },
+  {  8,   12,  156,  157 },
+  { -1,    0,   77,    0 },
+  {  7,   18,  158,  159 },
+  { -1,    0,   78,    0 },
+  { -1,    0,   79,    0 },
+  {  9,   29,  161,  166 },
+  { 10,   32,  162,  163 },
+  { -1,    0,   80,    0 },
+  {  9,   27,  164,  165 },
+  { -1,    0,   81,    0 },
+  { -1,    0,   82,    0 },
+  { 10,   49,  167,  170 },
+  {  9,   31,  168,  169 },
+  { -1,    0,   83,    0 },
+  { -1,    0,   84,    0 },
+  {  7,   26,  171,  172 },
+  { -1,    0,   85,    0 },
+  { -1,    0,   86,    0 },
+  {  1,    4,  174,  179 },
+  {  8,   21,  175,  176 },
+  { -1,    0,   87,    0 },
+  {  9,   41,  177,  178 },
+  { -1,    0,   88,    0 },
+  { -1,    0,   89,    0 },
+  { -1,    0,   90,    0 },
+  { -1,    0,   91,    0 },
+  {  3,    2,  182,  243 },
+  { 12,    0,  183,  210 },
+  { 13,    0,  184,  207 },
+  {  4,   31,  185,  194 },
+  {  9,   27,  186,  191 },
+  { 13,   -1,  187,  190 },
+  { 13,   -2,  188,  189 },
+  { -1,    0,   92,    0 },
+  { -1,    0,   93,    0 },
+  { -1,    0,   94,    0 },
+  { 11,    0,  192,  193 },
+  { -1,    0,   95,    0 },
+  { -1,    0,   96,    0 },
+  { 11,    0,  195,  200 },
+  {  6,   32,  196,  197 },
+  { -1,    0,   97,    0 },
+  {  6,   52,  198,  199 },
+  { -1,    0,   98,    0 },
+  { -1,    0,   99,    0 },
+  { 10,   11,  201,  204 },
+  { 10,    2,  202,  203 },
+  { -1,    0,  100,    0 },
+  { -1,    0,  101,    0 },
+  {  6,   75,  205,  206 },
+  { -1,    0,  102,    0 },
+  { -1,    0,  103,    0 },
+  {  4,   31,  208,  209 },
+  { -1,    0,  104,    0 },
+  { -1,    0,  105,    0 },
+  { 13,    1,  211,  236 },
+  {  5,    0,  212,  221 },
+  { 10,   42,  213,  216 },
+  {  9,   30,  214,  215 },
+  { -1,    0,  106,    0 },
+  { -1,    0,  107,    0 },
+  { 10,   45,  217,  218 },
+  { -1,    0,  108,    0 },
+  {  7,   38,  219,  220 },
+  { -1,    0,  109,    0 },
+  { -1,    0,  110,    0 },
+  { 13,    0,  222,  229 },
+  {  0,    2,  223,  226 },
+  {  1,    2,  224,  225 },
+  { -1,    0,  111,    0 },
+  { -1,    0,  112,    0 },
+  { 10,   16,  227,  228 },
+  { -1,    0,  113,    0 },
+  { -1,    0,  114,    0 },
+  { 10,   51,  230,  233 },
+  {  8,   17,  231,  232 },
+  { -1,    0,  115,    0 },
+  { -1,    0,  116,    0 },
+  {  8,   29,  234,  235 },
+  { -1,    0,  117,    0 },
+  { -1,    0,  118,    0 },
+  {  1,    4,  237,  242 },
+  {  8,   21,  238,  239 },
+  { -1,    0,  119,    0 },
+  {  4,   27,  240,  241 },
+  { -1,    0,  120,    0 },
+  { -1,    0,  121,    0 },
+  { -1,    0,  122,    0 },
+  { -1,    0,  123,    0 },
+};
+
+// class distributions of the leaves in per mille
+static constexpr uint16_t g_splitPredLeaves[][NUM_SPLIT_PRED_CLASSES] =
+{
+  {  994,    0,    1,    1,    4,    0 },
+  {  846,    0,   70,   70,   14,    0 },
+  {  911,    0,   23,   48,    0,   19 },
+  {  740,    0,   22,   48,   88,  101 },
+  {  571,    0,  149,  166,   39,   75 },
+  { 1000,    0,    0,    0,    0,    0 },
+  {  995,    0,    0,    5,    0,    0 },
+  {  995,    0,    4,    0,    0,    0 },
+  {  953,    0,   29,    2,    0,   16 },
+  {  801,   80,    5,   94,    0,   20 },
+  {  978,    0,    5,    5,    0,   11 },
+  {  922,    0,   49,   29,    0,    0 },
+  {  590,    0,   78,   64,   92,  176 },
+  {  913,    0,   13,    8,   26,   39 },
+  {  209,    2,  214,  148,  259,  167 },
+  {  498,  103,  148,   81,   45,  124 },
+  {  904,    0,   42,   54,    0,    0 },
+  {  798,    0,   20,  109,   11,   62 },
+  {  770,   25,  128,   25,   38,   15 },
+  { 1000,    0,    0,    0,    0,    0 },
+  {  836,    0,  123,    0,   41,    0 },
+  {  797,    4,   68,   82,   24,   25 },
+  {  712,   16,   90,  127,   26,   28 },
+  {  553,   19,  146,  181,   47,   53 },
+  {  568,    0,  121,  131,   71,  110 },
+  {  733,    0,   85,  103,   34,   46 },
+  {  344,    4,   66,  210,   84,  293 },
+  {  468,    0,  133,  184,   79,  136 },
+  {  642,    0,   84,  147,   60,   67 },
+  {  211,  352,  171,   99,   81,   87 },
+  { 1000,    0,    0,    0,    0,    0 },
+  { 1000,    0,    0,    0,    0,    0 },
+  {  976,    0,    6,    2,   10,    6 },
+  {  820,    0,  126,   16,   11,   27 },
+  {  895,    0,    0,   54,   36,   16 },
+  {  896,    0,   38,   14,    0,   51 },
+  {  394,    0,  151,  169,  104,  181 },
+  {  909,    0,   30,   58,    0,    2 },
+  {  754,    0,  101,   51,   40,   54 },
+  { 1000,    0,    0,    0,    0,    0 },
+  {  994,    0,    2,    4,    0,    0 },
+  {  974,    0,   18,    2,    5,    0 },
+  {  784,   87,   52,   38,   27,   11 },
+  {  985,    0,    2,    9,    0,    4 },
+  {  873,    0,   68,   59,    0,    0 },
+  {  899,    0,   31,   46,    0,   23 },
+  {  185,    3,  214,  148,  295,  155 },
+  {  423,   46,  211,   96,  105,  119 },
+  {  752,    0,   22,  170,   20,   36 },
+  {  835,    0,   31,   92,    8,   33 },
+  {  782,   23,  128,   45,   16,    6 },
+  { 1000,    0,    0,    0,    0,    0 },
+  {  835,    0,  126,    0,   39,    0 },
+  {  798,    0,   53,  111,    0,   37 },
+  {  754,    8,  100,   82,   39,   17 },
+  {  539,   39,  120,  144,   74,   84 },
+  {  763,    0,   96,   89,   30,   22 },
+  {  479,    0,  267,  180,   22,   53 },
+  {  594,    0,  100,  190,   38,   78 },
+  {  337,    4,   53,  210,   98,  298 },
+  {  512,    0,   97,  204,   42,  144 },
+  {  567,    0,  112,  105,  147,   68 },
+  {  218,  329,  173,  104,   77,   99 },
+  { 1000,    0,    0,    0,    0,    0 },
+  {  962,    0,   12,   20,    4,    3 },
+  {  750,    0,   40,   49,  122,   39 },
+  {  965,    3,    6,   10,   14,    1 },
+  {  996,    0,    1,    0,    1,    2 },
+  {  940,    0,   19,   42,    0,    0 },
+  {  486,    0,  140,  290,   45,   40 },
+  {  763,    0,  109,   95,    2,   31 },
+  {  870,    0,   46,    7,   34,   44 },
+  {  449,    0,   72,  126,  118,  234 },
+  { 1000,    0,    0,    0,    0,    0 },
+  {  890,    0,  110,    0,    0,    0 },
+  {  850,    0,   57,   93,    0,    0 },
+  {  702,    0,  157,  142,    0,    0 },
+  {  621,    0,   22,  171,    0,  186 },
+  {  851,    0,   51,   74,    0,   24 },
+  {  752,    0,   53,  127,    0,   69 },
+  {  294,   41,  134,  149,  280,  103 },
+  {  767,    0,   54,   78,   75,   27 },
+  {  731,    0,  117,   72,   33,   48 },
+  {  600,    0,  219,   78,   30,   73 },
+  {  770,    9,  100,   66,   35,   20 },
+  {  318,  111,  214,  135,  201,   21 },
+  {  698,    9,  127,  106,   32,   28 },
+  {  327,   10,   65,  261,   80,  257 },
+  {  476,    0,  158,   97,   62,  206 },
+  {  625,    0,   89,  144,   57,   85 },
+  {  291,  219,  207,  146,   62,   74 },
+  { 1000,    0,    0,    0,    0,    0 },
+  {  993,    0,    1,    2,    0,    4 },
+  {  965,    0,   27,    0,    8,    0 },
+  {  933,    0,    4,   42,    0,   21 },
+  {  534,    0,  188,  161,   33,   84 },
+  {  726,    0,   30,   79,   84,   80 },
+  { 1000,    0,    0,    0,    0,    0 },
+  {  516,  326,    4,  138,   16,    0 },
+  {  954,    0,   25,   19,    1,    1 },
+  { 1000,    0,    0,    0,    0,    0 },
+  {  994,    0,    6,    0,    0,    0 },
+  { 1000,    0,    0,    0,    0,    0 },
+  {  974,    0,    0,    1,    0,   25 },
+  {  611,    0,   62,   57,  118,  152 },
+  {  876,    0,   24,   48,    0,   53 },
+  {  186,    3,  234,  120,  290,  168 },
+  {  370,   97,  204,  112,   80,  136 },
+  {  847,    0,   85,   38,    7,   22 },
+  {  604,   55,  114,  146,   48,   33 },
+  {  811,    0,   45,  104,   19,   20 },
+  { 1000,    0,    0,    0,    0,    0 },
+  {  835,    0,  120,    0,   44,    0 },
+  {  907,    0,   29,   35,   16,   13 },
+  {  763,    4,   86,   97,   23,   27 },
+  {  547,   28,   92,  153,  117,   64 },
+  {  753,    0,   89,   93,   39,   26 },
+  {  485,    0,  179,  259,   33,   44 },
+  {  615,    0,   84,  179,   25,   97 },
+  {  316,   10,   58,  221,   86,  309 },
+  {  644,    0,   88,  168,   57,   42 },
+  {  469,    0,  138,  169,   71,  153 },
+  {  201,  355,  169,  110,   93,   72 },
+  { 1000,    0,    0,    0,    0,    0 },
+};
+//TABLES_END
+
+// ====================================================================================================================
+// Class implementation
+// ====================================================================================================================
+
+SplitPredictor::SplitPredictor()
+  : m_enabled  ( false )
+  , m_threshold( 0 )
+  , m_dumpFile ( nullptr )
+{
+}
+
+SplitPredictor::~SplitPredictor()
+{
+  if( m_dumpFile )
+  {
+    fclose( m_dumpFile );
+  }
+}
+
+void SplitPredictor::init( const EncCfg& cfg )
+{
+  m_enabled   = cfg.getUseSplitPredictor();
+  m_threshold = cfg.getSplitPredictorThreshold();
+
+  if( !cfg.getSplitPredictorDumpFile().empty() )
+  {
+    // append, so that the samples of several encodings can be collected in one file
+    m_dumpFile = fopen( cfg.getSplitPredictorDumpFile().c_str(), "a" );
+    CHECK( m_dumpFile == nullptr, "Cannot open split predictor dump file " << cfg.getSplitPredictorDumpFile() );
+  }
+}
+
+void SplitPredictor::extract( SplitFeatures& sf, const CodingStructure& cs, const Partitioner& partitioner, const CodingStructure* bestCS, RdCost* rdCost ) const
+{
+  sf.valid = false;
+
+  if( !bestCS || bestCS->cus.size() != 1 || !isLuma( partitioner.chType ) )
+  {
+    return;
+  }
+
+  const CompArea&   area     = partitioner.currArea().Y();
+  const CodingUnit& bestCU   = *bestCS->cus.front();
+  const int         shift    = cs.sps->getBitDepth( CHANNEL_TYPE_LUMA ) - 8;
+  const int         width    = area.width;
+  const int         height   = area.height;
+  const int         numPels  = width * height;
+  const CPelBuf     org      = cs.getOrgBuf( area );
+
+  int64_t sum   = 0;
+  int64_t sumSq = 0;
+  int64_t gradH = 0;
+  int64_t gradV = 0;
+
+  for( int y = 0; y < height; y++ )
+  {
+    const Pel* line = org.bufAt( 0, y );
+    const Pel* prev = y > 0 ? org.bufAt( 0, y - 1 ) : line;
+
+    for( int x = 0; x < width; x++ )
+    {
+      sum   += line[x];
+      sumSq += line[x] * line[x];
+      gradV += abs( line[x] - prev[x] );
+    }
+    for( int x = 1; x < width; x++ )
+    {
+      gradH += abs( line[x] - line[x - 1] );
+    }
+  }
+
+  const double variance = double( sumSq - sum * sum / numPels ) / ( numPels << ( 2 * shift ) );
+
+  DistParam distParam;
+  rdCost->setDistParam( distParam, org, bestCS->getPredBuf( area ), cs.sps->getBitDepth( CHANNEL_TYPE_LUMA ), COMPONENT_Y, true );
+  const double hadCost = double( distParam.distFunc( distParam ) >> shift ) / numPels;
+  const double rdCostN = bestCS->cost / ( rdCost->getLambda() * numPels );
+
+  int neighSize = 0;
+  for( const Position& pos : { area.pos().offset( -1, 0 ), area.pos().offset( 0, -1 ) } )
+  {
+    if( const CodingUnit* cu = cs.getCU( pos, partitioner.chType ) )
+    {
+      neighSize += g_aucLog2[width] + g_aucLog2[height] - g_aucLog2[cu->lwidth()] - g_aucLog2[cu->lheight()];
+    }
+  }
+
+  sf.f[SPF_LOG2_WIDTH ] = g_aucLog2[width];
+  sf.f[SPF_LOG2_HEIGHT] = g_aucLog2[height];
+  sf.f[SPF_QT_DEPTH   ] = partitioner.currQtDepth;
+  sf.f[SPF_MT_DEPTH   ] = partitioner.currMtDepth;
+  sf.f[SPF_QP         ] = bestCU.qp;
+  sf.f[SPF_SLICE_INTRA] = cs.slice->isIntra() ? 1 : 0;
+  sf.f[SPF_VARIANCE   ] = int( 8 * std::log2( 1.0 + variance ) );
+  sf.f[SPF_GRAD_HOR   ] = width  > 1 ? int( ( ( 4 * gradH ) >> shift ) / ( ( width - 1 ) * height ) ) : 0;
+  sf.f[SPF_GRAD_VER   ] = height > 1 ? int( ( ( 4 * gradV ) >> shift ) / ( width * ( height - 1 ) ) ) : 0;
+  sf.f[SPF_HAD_COST   ] = int( 8 * std::log2( 1.0 + hadCost ) );
+  sf.f[SPF_RD_COST    ] = int( 8 * std::log2( 1.0 + rdCostN ) );
+  sf.f[SPF_BEST_SKIP  ] = bestCU.skip    ? 1 : 0;
+  sf.f[SPF_BEST_CBF   ] = bestCU.rootCbf ? 1 : 0;
+  sf.f[SPF_NEIGH_SIZE ] = neighSize;
+
+  if( m_enabled )
+  {
+    predict( sf, sf.prob );
+  }
+
+  sf.valid = true;
+}
+
+void SplitPredictor::predict( const SplitFeatures& sf, int prob[NUM_SPLIT_PRED_CLASSES] ) const
+{
+  for( int c = 0; c < NUM_SPLIT_PRED_CLASSES; c++ )
+  {
+    prob[c] = 0;
+  }
+
+  for( int t = 0; t < NUM_SPLIT_PRED_TREES; t++ )
+  {
+    const SplitPredNode* node = &g_splitPredNodes[g_splitPredRoots[t]];
+
+    while( node->feature >= 0 )
+    {
+      node = &g_splitPredNodes[sf.f[node->feature] <= node->threshold ? node->left : node->right];
+    }
+
+    for( int c = 0; c < NUM_SPLIT_PRED_CLASSES; c++ )
+    {
+      prob[c] += g_splitPredLeaves[node->left][c];
+    }
+  }
+
+  for( int c = 0; c < NUM_SPLIT_PRED_CLASSES; c++ )
+  {
+    prob[c] /= NUM_SPLIT_PRED_TREES;
+  }
+}
+
+static int getSplitPredClass( const PartSplit split )
+{
+  switch( split )
+  {
+  case CU_QUAD_SPLIT: return SPC_QT;
+  case CU_HORZ_SPLIT: return SPC_BT_H;
+  case CU_VERT_SPLIT: return SPC_BT_V;
+  case CU_TRIH_SPLIT: return SPC_TT_H;
+  case CU_TRIV_SPLIT: return SPC_TT_V;
+  default:            return SPC_NO_SPLIT;
+  }
+}
+
+bool SplitPredictor::prune( const SplitFeatures& sf, const PartSplit split ) const
+{
+  if( !m_enabled || !sf.valid )
+  {
+    return false;
+  }
+
+  if( split == CU_QUAD_SPLIT )
+  {
+    // the QT split is the only way to reach the small block sizes, only skip it if not splitting is almost certain
+    return sf.prob[SPC_NO_SPLIT] >= 1000 - m_threshold;
+  }
+
+  const int cls = getSplitPredClass( split );
+
+  if( sf.prob[cls] >= m_threshold )
+  {
+    return false;
+  }
+
+  // keep the most probable split, unless not splitting at all is almost certain
+  int bestSplitCls = SPC_QT;
+  for( int c = SPC_QT + 1; c < NUM_SPLIT_PRED_CLASSES; c++ )
+  {
+    if( sf.prob[c] > sf.prob[bestSplitCls] )
+    {
+      bestSplitCls = c;
+    }
+  }
+
+  return cls != bestSplitCls || sf.prob[SPC_NO_SPLIT] >= 1000 - m_threshold;
+}
+
+void SplitPredictor::dump( const SplitFeatures& sf, const PartSplit bestSplit ) const
+{
+  if( !m_dumpFile || !sf.valid )
+  {
+    return;
+  }
+
+  // one sample per line: the features in SplitPredFeature order followed by the SplitPredClass label
+  for( int i = 0; i < NUM_SPLIT_PRED_FEATURES; i++ )
+  {
+    fprintf( m_dumpFile, "%d ", sf.f[i] );
+  }
+  fprintf( m_dumpFile, "%d\n", getSplitPredClass( bestSplit ) );
+}
+
+//! \}
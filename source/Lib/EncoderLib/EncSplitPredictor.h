@@ -0,0 +1,126 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2018, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     EncSplitPredictor.h
+    \brief    learned CU split decision predictor (header)
+*/
+
+#ifndef __ENCSPLITPREDICTOR__
+#define __ENCSPLITPREDICTOR__
+
+#include "CommonLib/CommonDef.h"
+#include "CommonLib/UnitPartitioner.h"
+
+#include <cstdio>
+
+//! \ingroup EncoderLib
+//! \{
+
+class EncCfg;
+class RdCost;
+
+// ====================================================================================================================
+// Constants
+// ====================================================================================================================
+
+enum SplitPredFeature
+{
+  SPF_LOG2_WIDTH = 0,
+  SPF_LOG2_HEIGHT,
+  SPF_QT_DEPTH,
+  SPF_MT_DEPTH,
+  SPF_QP,
+  SPF_SLICE_INTRA,
+  SPF_VARIANCE,           ///< 8 * log2( 1 + variance ) of the original luma samples (8-bit scale)
+  SPF_GRAD_HOR,           ///< mean absolute horizontal gradient (8-bit scale, 1/4 precision)
+  SPF_GRAD_VER,           ///< mean absolute vertical gradient (8-bit scale, 1/4 precision)
+  SPF_HAD_COST,           ///< 8 * log2( 1 + SATD per sample ) of the best non-split prediction
+  SPF_RD_COST,            ///< 8 * log2( 1 + J / ( lambda * samples ) ) of the best non-split mode
+  SPF_BEST_SKIP,
+  SPF_BEST_CBF,
+  SPF_NEIGH_SIZE,         ///< summed log2 area difference to the left and above CUs
+  NUM_SPLIT_PRED_FEATURES
+};
+
+enum SplitPredClass
+{
+  SPC_NO_SPLIT = 0,
+  SPC_QT,
+  SPC_BT_H,
+  SPC_BT_V,
+  SPC_TT_H,
+  SPC_TT_V,
+  NUM_SPLIT_PRED_CLASSES
+};
+
+// ====================================================================================================================
+// Class definition
+// ====================================================================================================================
+
+struct SplitFeatures
+{
+  bool valid;
+  int  f   [NUM_SPLIT_PRED_FEATURES];
+  int  prob[NUM_SPLIT_PRED_CLASSES];      ///< predicted class distribution in per mille
+};
+
+/// predicts which CU splits are worth an RD check from cheap block features
+class SplitPredictor
+{
+public:
+  SplitPredictor();
+  ~SplitPredictor();
+
+  void init   ( const EncCfg& cfg );
+
+  bool isActive     () const { return m_enabled || m_dumpFile != nullptr; }
+  bool isEnabled    () const { return m_enabled; }
+
+  /// gathers the features once the non-split modes of the CU have been tested
+  void extract      ( SplitFeatures& sf, const CodingStructure& cs, const Partitioner& partitioner, const CodingStructure* bestCS, RdCost* rdCost ) const;
+  /// returns true if the split does not need to be tested
+  bool prune        ( const SplitFeatures& sf, const PartSplit split ) const;
+  /// writes one training sample, the label is the split of the finally chosen mode
+  void dump         ( const SplitFeatures& sf, const PartSplit bestSplit ) const;
+
+private:
+  void predict      ( const SplitFeatures& sf, int prob[NUM_SPLIT_PRED_CLASSES] ) const;
+
+  bool  m_enabled;
+  int   m_threshold;
+  FILE *m_dumpFile;
+};
+
+//! \}
+
+#endif // __ENCSPLITPREDICTOR__
@@ -83,8 +83,164 @@ static const Mv s_acMvRefineQ[9] =
 };
 
 
+// ====================================================================================================================
+// Merge prediction cache
+// ====================================================================================================================
+
+void MergePredCache::create( const ChromaFormat chFmt, const unsigned maxWidth, const unsigned maxHeight )
+{
+  for( int i = 0; i < NUM_ENTRIES; i++ )
+  {
+    m_entries[i].pred.create( chFmt, Area( 0, 0, maxWidth, maxHeight ) );
+  }
+
+  m_enabled = true;
+  reset();
+}
+
+void MergePredCache::destroy()
+{
+  for( int i = 0; i < NUM_ENTRIES; i++ )
+  {
+    m_entries[i].pred.destroy();
+  }
+
+  m_enabled = false;
+}
+
+void MergePredCache::reset()
+{
+  for( int i = 0; i < NUM_ENTRIES; i++ )
+  {
+    m_entries[i].valid = false;
+  }
+
+  m_poc        = -1;
+  m_sliceStart = 0;
+  m_useCounter = 0;
+}
+
+bool MergePredCache::xGetKey( const PredictionUnit& pu, Key& key )
+{
+  const Slice &slice = *pu.cs->slice;
+
+  // the sub-block merge modes and affine do not derive the samples from the block motion only
+  if( !m_enabled || pu.mergeType != MRG_TYPE_DEFAULT_N || pu.cu->affine )
+  {
+    return false;
+  }
+
+  // reference lists and weighted prediction parameters are given per slice
+  if( slice.getPOC() != m_poc || slice.getSliceCurStartCtuTsAddr() != m_sliceStart )
+  {
+    reset();
+    m_poc        = slice.getPOC();
+    m_sliceStart = slice.getSliceCurStartCtuTsAddr();
+  }
+
+  key.area = pu.Y();
+
+  for( uint32_t refList = 0; refList < NUM_REF_PIC_LIST_01; refList++ )
+  {
+    if( pu.refIdx[refList] < 0 )
+    {
+      key.refIdx[refList] = NOT_VALID;
+      key.clipMv[refList] = Mv();
+      continue;
+    }
+
+    key.refIdx[refList] = pu.refIdx[refList];
+    key.clipMv[refList] = pu.mv[refList];
+    clipMv( key.clipMv[refList], pu.cu->lumaPos(), *pu.cs->sps );
+  }
+
+  // same decision as InterPrediction::xCheckIdenticalMotion, which compares the motion before the clipping
+  key.identical = slice.isInterB() && !pu.cs->pps->getWPBiPred() && pu.refIdx[0] >= 0 && pu.refIdx[1] >= 0
+               && slice.getRefPOC( REF_PIC_LIST_0, pu.refIdx[0] ) == slice.getRefPOC( REF_PIC_LIST_1, pu.refIdx[1] ) && pu.mv[0] == pu.mv[1];
+
+  return true;
+}
+
+bool MergePredCache::getPred( const PredictionUnit& pu, PelUnitBuf& predBuf )
+{
+  Key key;
+
+  if( !xGetKey( pu, key ) )
+  {
+    return false;
+  }
+
+  Entry *match = nullptr;
+
+  for( int i = 0; i < NUM_ENTRIES; i++ )
+  {
+    Entry &entry = m_entries[i];
+
+    if( !entry.valid || !entry.key.area.contains( key.area ) || !entry.key.sameMotion( key ) )
+    {
+      continue;
+    }
+
+    match = &entry;
+
+    if( entry.key.area == key.area )
+    {
+      break;
+    }
+  }
+
+  if( match == nullptr )
+  {
+    return false;
+  }
+
+  const Area subArea( key.area.x - match->key.area.x, key.area.y - match->key.area.y, key.area.width, key.area.height );
+
+  predBuf.copyFrom( match->pred.getBuf( UnitArea( pu.chromaFormat, subArea ) ) );
+  match->lastUse = ++m_useCounter;
+
+  return true;
+}
+
+void MergePredCache::setPred( const PredictionUnit& pu, const CPelUnitBuf& predBuf )
+{
+  Key key;
+
+  if( !xGetKey( pu, key ) )
+  {
+    return;
+  }
+
+  Entry *slot = &m_entries[0];
+
+  for( int i = 0; i < NUM_ENTRIES; i++ )
+  {
+    if( !m_entries[i].valid )
+    {
+      slot = &m_entries[i];
+      break;
+    }
+
+    if( m_entries[i].lastUse < slot->lastUse )
+    {
+      slot = &m_entries[i];
+    }
+  }
+
+  slot->valid   = true;
+  slot->key     = key;
+  slot->lastUse = ++m_useCounter;
+
+  slot->pred.getBuf( UnitArea( pu.chromaFormat, Area( 0, 0, key.area.width, key.area.height ) ) ).copyFrom( predBuf );
+}
+
+
 InterSearch::InterSearch()
   : m_modeCtrl                    (nullptr)
+  , m_crossQpCache                (nullptr)
+  , m_motionFieldCache            (nullptr)
+  , m_globalMotion                (nullptr)
+  , m_refSubPelCache              (nullptr)
   , m_pSplitCS                    (nullptr)
   , m_pFullCS                     (nullptr)
   , m_pcEncCfg                    (nullptr)
@@ -238,6 +394,13 @@ void InterSearch::init( EncCfg*        pcEncCfg,
 
 inline void InterSearch::xTZSearchHelp( IntTZSearchStruct& rcStruct, const int iSearchX, const int iSearchY, const uint8_t ucPointNr, const uint32_t uiDistance )
 {
+  if( rcStruct.batchCandidates )
+  {
+    CHECK( rcStruct.numCandidates >= 16, "Too many batched search points" );
+    rcStruct.candidates[rcStruct.numCandidates++] = { iSearchX, iSearchY, ucPointNr, uiDistance };
+    return;
+  }
+
   Distortion  uiSad = 0;
 
 //  CHECK(!( !( rcStruct.searchRange.left > iSearchX || rcStruct.searchRange.right < iSearchX || rcStruct.searchRange.top > iSearchY || rcStruct.searchRange.bottom < iSearchY )), "Unspecified error");
@@ -305,23 +468,74 @@ inline void InterSearch::xTZSearchHelp( IntTZSearchStruct& rcStruct, const int i
   {
     uiSad = m_cDistParam.distFunc( m_cDistParam );
 
-    // only add motion cost if uiSad is smaller than best. Otherwise pointless
-    // to add motion cost.
+    xTZSearchUpdate( rcStruct, uiSad, iSearchX, iSearchY, ucPointNr, uiDistance );
+  }
+}
+
+inline void InterSearch::xTZSearchUpdate( IntTZSearchStruct& rcStruct, Distortion uiSad, const int iSearchX, const int iSearchY, const uint8_t ucPointNr, const uint32_t uiDistance )
+{
+  // only add motion cost if uiSad is smaller than best. Otherwise pointless
+  // to add motion cost.
+  if( uiSad < rcStruct.uiBestSad )
+  {
+    // motion cost
+    uiSad += m_pcRdCost->getCostOfVectorWithPredictor( iSearchX, iSearchY, rcStruct.imvShift );
+
     if( uiSad < rcStruct.uiBestSad )
     {
-      // motion cost
-      uiSad += m_pcRdCost->getCostOfVectorWithPredictor( iSearchX, iSearchY, rcStruct.imvShift );
+      rcStruct.uiBestSad      = uiSad;
+      rcStruct.iBestX         = iSearchX;
+      rcStruct.iBestY         = iSearchY;
+      rcStruct.uiBestDistance = uiDistance;
+      rcStruct.uiBestRound    = 0;
+      rcStruct.ucPointNr      = ucPointNr;
+      m_cDistParam.maximumDistortionForEarlyExit = uiSad;
+    }
+  }
+}
+
+inline void InterSearch::xTZSearchBatchBegin( IntTZSearchStruct& rcStruct )
+{
+  // the sub-sampled search with its own pyramid termination stays point by point
+  rcStruct.batchCandidates = rcStruct.subShiftMode != 1;
+  rcStruct.numCandidates   = 0;
+}
+
+inline void InterSearch::xTZSearchBatchEnd( IntTZSearchStruct& rcStruct )
+{
+  if( !rcStruct.batchCandidates )
+  {
+    return;
+  }
+  rcStruct.batchCandidates = false;
+
+  // The SADs of a group are computed against the best cost at its start, which is never below the current one. A sum
+  // stopped early therefore exceeds the best cost as well and the points are decided in their original order as before.
+  for( int i = 0; i < rcStruct.numCandidates; i += 4 )
+  {
+    const int  num = std::min( 4, rcStruct.numCandidates - i );
+    Distortion uiSad[4];
 
-      if( uiSad < rcStruct.uiBestSad )
+    if( num == 1 )
+    {
+      m_cDistParam.cur.buf = rcStruct.piRefY + rcStruct.candidates[i].iSearchY * rcStruct.iRefStride + rcStruct.candidates[i].iSearchX;
+      uiSad[0]             = m_cDistParam.distFunc( m_cDistParam );
+    }
+    else
+    {
+      const Pel* piRefSrch[4];
+      for( int k = 0; k < 4; k++ )
       {
-        rcStruct.uiBestSad      = uiSad;
-        rcStruct.iBestX         = iSearchX;
-        rcStruct.iBestY         = iSearchY;
-        rcStruct.uiBestDistance = uiDistance;
-        rcStruct.uiBestRound    = 0;
-        rcStruct.ucPointNr      = ucPointNr;
-        m_cDistParam.maximumDistortionForEarlyExit = uiSad;
+        const auto &cand = rcStruct.candidates[i + std::min( k, num - 1 )];
+        piRefSrch[k]     = rcStruct.piRefY + cand.iSearchY * rcStruct.iRefStride + cand.iSearchX;
       }
+      m_pcRdCost->getSADx4( m_cDistParam, piRefSrch, uiSad );
+    }
+
+    for( int k = 0; k < num; k++ )
+    {
+      const auto &cand = rcStruct.candidates[i + k];
+      xTZSearchUpdate( rcStruct, uiSad[k], cand.iSearchX, cand.iSearchY, cand.ucPointNr, cand.uiDistance );
     }
   }
 }
@@ -368,6 +582,7 @@ inline void InterSearch::xTZ8PointSquareSearch( IntTZSearchStruct& rcStruct, con
   const int iLeft       = iStartX - iDist;
   const int iRight      = iStartX + iDist;
   rcStruct.uiBestRound += 1;
+  xTZSearchBatchBegin( rcStruct );
 
   if ( iTop >= sr.top ) // check top
   {
@@ -405,6 +620,7 @@ inline void InterSearch::xTZ8PointSquareSearch( IntTZSearchStruct& rcStruct, con
       xTZSearchHelp( rcStruct, iRight, iBottom, 8, iDist );
     }
   } // check bottom
+  xTZSearchBatchEnd( rcStruct );
 }
 
 
@@ -426,6 +642,7 @@ inline void InterSearch::xTZ8PointDiamondSearch( IntTZSearchStruct& rcStruct,
   const int iLeft       = iStartX - iDist;
   const int iRight      = iStartX + iDist;
   rcStruct.uiBestRound += 1;
+  xTZSearchBatchBegin( rcStruct );
 
   if ( iDist == 1 )
   {
@@ -611,18 +828,20 @@ inline void InterSearch::xTZ8PointDiamondSearch( IntTZSearchStruct& rcStruct,
       } // check border
     } // iDist <= 8
   } // iDist == 1
+  xTZSearchBatchEnd( rcStruct );
 }
 
 Distortion InterSearch::xPatternRefinement( const CPelBuf* pcPatternKey,
                                             Mv baseRefMv,
                                             int iFrac, Mv& rcMvFrac,
-                                            bool bAllowUseOfHadamard )
+                                            bool bAllowUseOfHadamard,
+                                            const RefSubPelCache::PhaseBufs* phases )
 {
   Distortion  uiDist;
   Distortion  uiDistBest  = std::numeric_limits<Distortion>::max();
   uint32_t        uiDirecBest = 0;
 
-  Pel*  piRefPos;
+  const Pel*  piRefPos;
   int iRefStride = pcPatternKey->width + 1;
   m_pcRdCost->setDistParam( m_cDistParam, *pcPatternKey, m_filteredBlock[0][0][0], iRefStride, m_lumaClpRng.bd, COMPONENT_Y, 0, 1, m_pcEncCfg->getUseHADME() && bAllowUseOfHadamard );
 
@@ -634,15 +853,24 @@ Distortion InterSearch::xPatternRefinement( const CPelBuf* pcPatternKey,
 
     int horVal = cMvTest.getHor() * iFrac;
     int verVal = cMvTest.getVer() * iFrac;
-    piRefPos = m_filteredBlock[verVal & 3][horVal & 3][0];
-
-    if (horVal == 2 && (verVal & 1) == 0)
+    if( phases )
     {
-      piRefPos += 1;
+      // the planes hold the phases at (x+fx/4,y+fy/4)
+      m_cDistParam.cur.stride = phases->stride[verVal & 3][horVal & 3];
+      piRefPos = phases->buf[verVal & 3][horVal & 3] + ( verVal >> 2 ) * m_cDistParam.cur.stride + ( horVal >> 2 );
     }
-    if ((horVal & 1) == 0 && verVal == 2)
+    else
     {
-      piRefPos += iRefStride;
+      piRefPos = m_filteredBlock[verVal & 3][horVal & 3][0];
+
+      if (horVal == 2 && (verVal & 1) == 0)
+      {
+        piRefPos += 1;
+      }
+      if ((horVal & 1) == 0 && verVal == 2)
+      {
+        piRefPos += iRefStride;
+      }
     }
     cMvTest = pcMvRefine[i];
     cMvTest += rcMvFrac;
@@ -1613,6 +1841,9 @@ void InterSearch::xMotionEstimation(PredictionUnit& pu, PelUnitBuf& origBuf, Ref
   cStruct.imvShift      = pu.cu->imv << 1;
   cStruct.inCtuSearch = false;
   cStruct.zeroMV = false;
+  cStruct.batchCandidates = false;
+  cStruct.numCandidates = 0;
+  cStruct.useGlobalMv = false;
   {
     if (pu.cs->sps->getSpsNext().getUseCompositeRef() && pu.cs->slice->getRefPic(eRefPicList, iRefIdxPred)->longTerm)
     {
@@ -1628,6 +1859,11 @@ void InterSearch::xMotionEstimation(PredictionUnit& pu, PelUnitBuf& origBuf, Ref
   if( !bBi )
   {
     bool bValid = blkCache && blkCache->getMv( pu, eRefPicList, iRefIdxPred, cIntMv );
+    if( !bValid && m_crossQpCache )
+    {
+      // start from the integer MV found by a pass at another QP
+      bValid = m_crossQpCache->getMv( pu.Y(), eRefPicList, iRefIdxPred, pu.cu->qp, cIntMv );
+    }
     if( bValid )
     {
       bQTBTMV2 = true;
@@ -1674,7 +1910,19 @@ void InterSearch::xMotionEstimation(PredictionUnit& pu, PelUnitBuf& origBuf, Ref
     {
       pIntegerMv2Nx2NPred = &( m_integerMv2Nx2N[eRefPicList][iRefIdxPred] );
     }
+    if( m_motionFieldCache && pu.cu->imv == 0 )
+    {
+      m_motionFieldCache->getSeeds( pu, eRefPicList, iRefIdxPred, cStruct.temporalSeeds );
+    }
+    if( m_globalMotion && pu.cu->imv == 0 )
+    {
+      cStruct.useGlobalMv = m_globalMotion->getMv( pu, eRefPicList, iRefIdxPred, cStruct.globalMv );
+    }
     xPatternSearchFast( pu, cStruct, rcMv, ruiCost, pIntegerMv2Nx2NPred );
+    if( m_crossQpCache )
+    {
+      m_crossQpCache->setMv( pu.Y(), eRefPicList, iRefIdxPred, pu.cu->qp, rcMv );
+    }
     if( blkCache )
     {
       blkCache->setMv( pu.cs->area, eRefPicList, iRefIdxPred, rcMv );
@@ -1948,6 +2196,40 @@ void InterSearch::xTZSearch( const PredictionUnit& pu,
       xTZSearchHelp( cStruct, integerMv2Nx2NPred.getHor(), integerMv2Nx2NPred.getVer(), 0, 0);
     }
   }
+
+  // temporally scaled motion of the coded pictures and the global motion, if one of them is the best start point the
+  // motion is assumed to be well predicted and the first search and the raster are restricted to the neighbourhood
+  static_vector<Mv, MotionFieldCache::MAX_NUM_SEEDS + 1> seeds( cStruct.temporalSeeds.begin(), cStruct.temporalSeeds.end() );
+  if( cStruct.useGlobalMv )
+  {
+    seeds.push_back( cStruct.globalMv );
+  }
+  bool bTemporalSeedStart = false;
+  for( const Mv& seed : seeds )
+  {
+    Mv temporalSeed = seed;
+#if REMOVE_MV_ADAPT_PREC
+    temporalSeed.hor = temporalSeed.hor << VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE;
+    temporalSeed.ver = temporalSeed.ver << VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE;
+#endif
+    clipMv( temporalSeed, pu.cu->lumaPos(), *pu.cs->sps );
+#if REMOVE_MV_ADAPT_PREC
+    temporalSeed.hor = temporalSeed.hor >> VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE;
+    temporalSeed.ver = temporalSeed.ver >> VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE;
+#endif
+    temporalSeed.divideByPowerOf2(2);
+
+    if( temporalSeed.getHor() != cStruct.iBestX || temporalSeed.getVer() != cStruct.iBestY )
+    {
+      const Distortion uiPrevBestSad = cStruct.uiBestSad;
+      xTZSearchHelp( cStruct, temporalSeed.getHor(), temporalSeed.getVer(), 0, 0 );
+      bTemporalSeedStart |= cStruct.uiBestSad < uiPrevBestSad;
+    }
+  }
+  if( bTemporalSeedStart )
+  {
+    iSearchRange = std::max( 4, iSearchRange >> 2 );
+  }
   {
     // set search range
     Mv currBestMv(cStruct.iBestX, cStruct.iBestY );
@@ -2035,7 +2317,7 @@ void InterSearch::xTZSearch( const PredictionUnit& pu,
     int iWindowSize     = iRaster;
     SearchRange localsr = sr;
 
-    if (!(bEnableRasterSearch && ( ((int)(cStruct.uiBestDistance) >= iRaster))))
+    if (!(bEnableRasterSearch && ( ((int)(cStruct.uiBestDistance) >= iRaster))) || bTemporalSeedStart)
     {
       iWindowSize ++;
       localsr.left   /= 2;
@@ -2054,7 +2336,7 @@ void InterSearch::xTZSearch( const PredictionUnit& pu,
   }
   else
   {
-    if ( bEnableRasterSearch && ( ((int)(cStruct.uiBestDistance) >= iRaster) || bAlwaysRasterSearch ) )
+    if ( bEnableRasterSearch && !bTemporalSeedStart && ( ((int)(cStruct.uiBestDistance) >= iRaster) || bAlwaysRasterSearch ) )
     {
       cStruct.uiBestDistance = iRaster;
       for ( iStartY = sr.top; iStartY <= sr.bottom; iStartY += iRaster )
@@ -2216,6 +2498,29 @@ void InterSearch::xTZSearchSelective( const PredictionUnit& pu,
     xTZSearchHelp( cStruct, integerMv2Nx2NPred.getHor(), integerMv2Nx2NPred.getVer(), 0, 0);
 
   }
+
+  // temporally scaled motion of the coded pictures and the global motion
+  static_vector<Mv, MotionFieldCache::MAX_NUM_SEEDS + 1> seeds( cStruct.temporalSeeds.begin(), cStruct.temporalSeeds.end() );
+  if( cStruct.useGlobalMv )
+  {
+    seeds.push_back( cStruct.globalMv );
+  }
+  for( const Mv& seed : seeds )
+  {
+    Mv temporalSeed = seed;
+#if REMOVE_MV_ADAPT_PREC
+    temporalSeed.hor = temporalSeed.hor << VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE;
+    temporalSeed.ver = temporalSeed.ver << VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE;
+#endif
+    clipMv( temporalSeed, pu.cu->lumaPos(), *pu.cs->sps );
+#if REMOVE_MV_ADAPT_PREC
+    temporalSeed.hor = temporalSeed.hor >> VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE;
+    temporalSeed.ver = temporalSeed.ver >> VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE;
+#endif
+    temporalSeed.divideByPowerOf2(2);
+
+    xTZSearchHelp( cStruct, temporalSeed.getHor(), temporalSeed.getVer(), 0, 0 );
+  }
   {
     // set search range
     Mv currBestMv(cStruct.iBestX, cStruct.iBestY );
@@ -2431,21 +2736,36 @@ void InterSearch::xPatternSearchFracDIF(
 
   //  Half-pel refinement
   m_pcRdCost->setCostScale(1);
-  xExtDIFUpSamplingH ( &cPatternRoi );
+  const Picture*                   refPic = pu.cu->slice->getRefPic( eRefPicList, iRefIdx );
+  const Position                   refPos = pu.Y().pos().offset( rcMvInt.getHor(), rcMvInt.getVer() );
+  RefSubPelCache::PhaseBufs        phaseBufs;
+  const RefSubPelCache::PhaseBufs* phases = nullptr;
+  if( m_refSubPelCache && m_refSubPelCache->hasAllPhases() )
+  {
+    // both refinements read the precomputed phases of the reference directly
+    phases = m_refSubPelCache->getPhases( *refPic, refPos, cPatternRoi, phaseBufs ) ? &phaseBufs : nullptr;
+  }
+  if( !phases && ( !m_refSubPelCache || m_refSubPelCache->hasAllPhases() || !xExtDIFUpSamplingHCached( &cPatternRoi, *refPic, refPos ) ) )
+  {
+    xExtDIFUpSamplingH ( &cPatternRoi );
+  }
 
   rcMvHalf = rcMvInt;   rcMvHalf <<= 1;    // for mv-cost
   Mv baseRefMv(0, 0);
-  ruiCost = xPatternRefinement(cStruct.pcPatternKey, baseRefMv, 2, rcMvHalf, !bIsLosslessCoded);
+  ruiCost = xPatternRefinement(cStruct.pcPatternKey, baseRefMv, 2, rcMvHalf, !bIsLosslessCoded, phases);
 
   //  quarter-pel refinement
   m_pcRdCost->setCostScale( 0 );
-  xExtDIFUpSamplingQ ( &cPatternRoi, rcMvHalf );
+  if( !phases )
+  {
+    xExtDIFUpSamplingQ ( &cPatternRoi, rcMvHalf );
+  }
   baseRefMv = rcMvHalf;
   baseRefMv <<= 1;
 
   rcMvQter = rcMvInt;    rcMvQter <<= 1;    // for mv-cost
   rcMvQter += rcMvHalf;  rcMvQter <<= 1;
-  ruiCost = xPatternRefinement( cStruct.pcPatternKey, baseRefMv, 1, rcMvQter, !bIsLosslessCoded );
+  ruiCost = xPatternRefinement( cStruct.pcPatternKey, baseRefMv, 1, rcMvQter, !bIsLosslessCoded, phases );
 }
 
 
@@ -2607,6 +2927,21 @@ void InterSearch::xPredAffineInterSearch( PredictionUnit&       pu,
         }
       }
 
+      // the control points of the global motion model as start position
+      Mv mvGlobal[3];
+      if ( m_globalMotion && m_globalMotion->getAffineMvs( pu, eRefPicList, iRefIdxTemp, mvGlobal ) )
+      {
+        Distortion uiCandCostGlobal = xGetAffineTemplateCost( pu, origBuf, predBuf, mvGlobal, aaiMvpIdx[iRefList][iRefIdxTemp], AMVP_MAX_NUM_CANDS, eRefPicList, iRefIdxTemp );
+        if ( uiCandCostGlobal < uiCandCost )
+        {
+          uiCandCost = uiCandCostGlobal;
+          for ( int i = 0; i < 3; i++ )
+          {
+            mvHevc[i] = mvGlobal[i];
+          }
+        }
+      }
+
       if ( uiCandCost < biPDistTemp )
       {
         ::memcpy( cMvTemp[iRefList][iRefIdxTemp], mvHevc, sizeof(Mv)*3 );
@@ -3206,15 +3541,14 @@ void InterSearch::xAffineMotionEstimation( PredictionUnit& pu,
 #endif
 
   // Set delta mv
-  // malloc buffer
   int iParaNum = pu.cu->affineType ? 7 : 5;
   int affineParaNum = iParaNum - 1;
   int mvNum = pu.cu->affineType ? 3 : 2;
-  double **pdEqualCoeff;
-  pdEqualCoeff = new double *[iParaNum];
+  double  dEqualCoeff[7][7];
+  double *pdEqualCoeff[7];
   for ( int i = 0; i < iParaNum; i++ )
   {
-    pdEqualCoeff[i] = new double[iParaNum];
+    pdEqualCoeff[i] = dEqualCoeff[i];
   }
 
   int64_t  i64EqualCoeff[7][7];
@@ -3460,10 +3794,6 @@ void InterSearch::xAffineMotionEstimation( PredictionUnit& pu,
   acMv[2].hor = acMv[2].hor >= 0 ? (acMv[2].hor + nOffset) >> nShift : -((-acMv[2].hor + nOffset) >> nShift);
   acMv[2].ver = acMv[2].ver >= 0 ? (acMv[2].ver + nOffset) >> nShift : -((-acMv[2].ver + nOffset) >> nShift);
 #endif
-  // free buffer
-  for ( int i=0; i<iParaNum; i++ )
-    delete []pdEqualCoeff[i];
-  delete []pdEqualCoeff;
 
   ruiBits = uiBitsBest;
   ruiCost = uiCostBest;
@@ -3577,6 +3907,41 @@ void InterSearch::xExtDIFUpSamplingH( CPelBuf* pattern )
   m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width + 1, height + 1, 2 << VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE, false, true, chFmt, clpRng);
 }
 
+/**
+* \brief Generate half-sample interpolated block reading the half-sample planes kept by the reference sub-pel cache
+*
+* \param pattern Reference picture ROI
+* \param refPic  Reference picture of the ROI
+* \param pos     Position of the ROI in the reference picture
+* \return false if the cache cannot serve the ROI, nothing is generated then
+*/
+bool InterSearch::xExtDIFUpSamplingHCached( CPelBuf* pattern, const Picture& refPic, const Position& pos )
+{
+  const ClpRng& clpRng = m_lumaClpRng;
+  int width      = pattern->width;
+  int height     = pattern->height;
+  int srcStride  = pattern->stride;
+
+  int intStride = width + 1;
+  int dstStride = width + 1;
+  int halfFilterSize = (NTAPS_LUMA>>1);
+
+  if( !m_refSubPelCache->getHalfPel( refPic, pos, *pattern, m_filteredBlockTmp[2][0], m_filteredBlock[2][0][0], m_filteredBlock[2][2][0], dstStride ) )
+  {
+    return false;
+  }
+
+  const ChromaFormat chFmt = m_currChromaFormat;
+
+  // the integer intermediate is needed by the quarter-sample stage as well
+  m_if.filterHor(COMPONENT_Y, pattern->buf - halfFilterSize*srcStride - 1, srcStride, m_filteredBlockTmp[0][0], intStride, width + 1, height + NTAPS_LUMA, 0 << VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE, false, chFmt, clpRng);
+
+  m_if.filterVer(COMPONENT_Y, m_filteredBlockTmp[0][0] + halfFilterSize * intStride + 1, intStride, m_filteredBlock[0][0][0], dstStride, width + 0, height + 0, 0 << VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE, false, true, chFmt, clpRng);
+  m_if.filterVer(COMPONENT_Y, m_filteredBlockTmp[2][0] + halfFilterSize * intStride,     intStride, m_filteredBlock[0][2][0], dstStride, width + 1, height + 0, 0 << VCEG_AZ07_MV_ADD_PRECISION_BIT_FOR_STORE, false, true, chFmt, clpRng);
+
+  return true;
+}
+
 
 
 
@@ -4410,8 +4775,7 @@ void InterSearch::encodeResAndCalcRdInterCU(CodingStructure &cs, Partitioner &pa
   }
 
   //  Residual coding.
-  cs.getResiBuf().copyFrom (cs.getOrgBuf());
-  cs.getResiBuf().subtract (cs.getPredBuf());
+  cs.getResiBuf().subtract (cs.getOrgBuf(), cs.getPredBuf());
   Distortion zeroDistortion = 0;
 
   const TempCtx ctxStart( m_CtxCache, m_CABACEstimator->getCtx() );
@@ -4474,27 +4838,29 @@ void InterSearch::encodeResAndCalcRdInterCU(CodingStructure &cs, Partitioner &pa
     cs.getResiBuf().fill(0); // Clear the residual image, if we didn't code it.
   }
 
-  cs.getRecoBuf().reconstruct(cs.getPredBuf(), cs.getResiBuf(), cs.slice->clpRngs());
-
-  // update with clipped distortion and cost (previously unclipped reconstruction values were used)
+  // reconstruct and update with clipped distortion and cost (previously unclipped reconstruction values were used)
   Distortion finalDistortion = 0;
 
   for (int comp = 0; comp < numValidComponents; comp++)
   {
     const ComponentID compID = ComponentID(comp);
-    CPelBuf reco = cs.getRecoBuf (compID);
+    PelBuf  reco = cs.getRecoBuf (compID);
+    CPelBuf pred = cs.getPredBuf (compID);
+    CPelBuf resi = cs.getResiBuf (compID);
     CPelBuf org  = cs.getOrgBuf  (compID);
 
 #if WCG_EXT
     if( m_pcEncCfg->getLumaLevelToDeltaQPMapping().isEnabled() )
     {
+      reco.reconstruct( pred, resi, cs.slice->clpRng( compID ) );
+
       const CPelBuf orgLuma = cs.getOrgBuf( cs.area.blocks[COMPONENT_Y] );
       finalDistortion += m_pcRdCost->getDistPart( org, reco, sps.getBitDepth( toChannelType( compID ) ), compID, DF_SSE_WTD, &orgLuma );
     }
     else
 #endif
     {
-      finalDistortion += m_pcRdCost->getDistPart( org, reco, sps.getBitDepth( toChannelType( compID ) ), compID, DF_SSE );
+      finalDistortion += m_pcRdCost->getRecoDistPart( reco, pred, resi, org, cs.slice->clpRng( compID ), sps.getBitDepth( toChannelType( compID ) ), compID );
     }
   }
 
@@ -41,6 +41,9 @@
 // Include files
 #include "CABACWriter.h"
 #include "EncCfg.h"
+#include "EncMotionFieldCache.h"
+#include "EncGlobalMotion.h"
+#include "EncRefSubPelCache.h"
 
 #include "CommonLib/MotionInfo.h"
 #include "CommonLib/InterPrediction.h"
@@ -62,12 +65,71 @@ static const uint32_t MAX_NUM_REF_LIST_ADAPT_SR = 2;
 static const uint32_t MAX_IDX_ADAPT_SR          = 33;
 static const uint32_t NUM_MV_PREDICTORS         = 3;
 class EncModeCtrl;
+class CrossQpCache;
+
+/// predicted samples of recently tested merge candidates, kept per block and motion so that a candidate which shows up
+/// again for the same block (multiple-QP loop, other split paths) or for a block inside an already predicted one
+/// (smaller CU shapes covering the same motion) is copied instead of motion compensated again
+class MergePredCache
+{
+public:
+  static const int NUM_ENTRIES = 16;
+
+  MergePredCache() : m_enabled( false ), m_poc( -1 ), m_sliceStart( 0 ), m_useCounter( 0 ) {}
+  ~MergePredCache() { destroy(); }
+
+  void create   ( const ChromaFormat chFmt, const unsigned maxWidth, const unsigned maxHeight );
+  void destroy  ();
+  bool isEnabled() const { return m_enabled; }
+  void reset    ();
+
+  /// fills the prediction of the merge PU from a cached block with the same motion covering it
+  bool getPred  ( const PredictionUnit& pu, PelUnitBuf& predBuf );
+  void setPred  ( const PredictionUnit& pu, const CPelUnitBuf& predBuf );
+
+private:
+  struct Key
+  {
+    Area       area;
+    bool       identical;                      ///< bi-prediction from twice the same motion (done as uni-prediction)
+    int        refIdx [NUM_REF_PIC_LIST_01];   ///< the weighted prediction parameters are given per reference index
+    Mv         clipMv [NUM_REF_PIC_LIST_01];   ///< motion after the clipping to the padded reference area
+
+    bool sameMotion( const Key& other ) const
+    {
+      return identical == other.identical && refIdx[0] == other.refIdx[0] && refIdx[1] == other.refIdx[1] && clipMv[0] == other.clipMv[0] && clipMv[1] == other.clipMv[1];
+    }
+  };
+
+  struct Entry
+  {
+    bool       valid;
+    Key        key;
+    uint64_t   lastUse;
+    PelStorage pred;
+  };
+
+  bool xGetKey  ( const PredictionUnit& pu, Key& key );
+
+  bool             m_enabled;
+  int              m_poc;
+  uint32_t         m_sliceStart;
+  uint64_t         m_useCounter;
+  Entry            m_entries[NUM_ENTRIES];
+};
+
 
 /// encoder search class
 class InterSearch : public InterPrediction, CrossComponentPrediction, AffineGradientSearch
 {
 private:
   EncModeCtrl     *m_modeCtrl;
+  CrossQpCache    *m_crossQpCache;
+  const MotionFieldCache
+                  *m_motionFieldCache;
+  const GlobalMotion
+                  *m_globalMotion;
+  RefSubPelCache  *m_refSubPelCache;
 
   PelStorage      m_tmpPredStorage              [NUM_REF_PIC_LIST_01];
   PelStorage      m_tmpStorageLCU;
@@ -137,7 +199,7 @@ public:
 protected:
 
   /// sub-function for motion vector refinement used in fractional-pel accuracy
-  Distortion  xPatternRefinement    ( const CPelBuf* pcPatternKey, Mv baseRefMv, int iFrac, Mv& rcMvFrac, bool bAllowUseOfHadamard );
+  Distortion  xPatternRefinement    ( const CPelBuf* pcPatternKey, Mv baseRefMv, int iFrac, Mv& rcMvFrac, bool bAllowUseOfHadamard, const RefSubPelCache::PhaseBufs* phases = nullptr );
 
    typedef struct
    {
@@ -163,10 +225,25 @@ protected:
     unsigned    imvShift;
     bool        inCtuSearch;
     bool        zeroMV;
+    MotionFieldCache::Seeds temporalSeeds;
+    bool        useGlobalMv;
+    Mv          globalMv;          // integer-pel start point from the global motion, in 1/4 sample units
+    bool        batchCandidates;   // collect the points of a search pattern and evaluate them four at a time
+    int         numCandidates;
+    struct
+    {
+      int       iSearchX;
+      int       iSearchY;
+      uint8_t   ucPointNr;
+      uint32_t  uiDistance;
+    }           candidates[16];
   } IntTZSearchStruct;
 
   // sub-functions for ME
   inline void xTZSearchHelp         ( IntTZSearchStruct& rcStruct, const int iSearchX, const int iSearchY, const uint8_t ucPointNr, const uint32_t uiDistance );
+  inline void xTZSearchUpdate       ( IntTZSearchStruct& rcStruct, Distortion uiSad, const int iSearchX, const int iSearchY, const uint8_t ucPointNr, const uint32_t uiDistance );
+  inline void xTZSearchBatchBegin   ( IntTZSearchStruct& rcStruct );
+  inline void xTZSearchBatchEnd     ( IntTZSearchStruct& rcStruct );
   inline void xTZ2PointSearch       ( IntTZSearchStruct& rcStruct );
   inline void xTZ8PointSquareSearch ( IntTZSearchStruct& rcStruct, const int iStartX, const int iStartY, const int iDist );
   inline void xTZ8PointDiamondSearch( IntTZSearchStruct& rcStruct, const int iStartX, const int iStartY, const int iDist, const bool bCheckCornersAtDist1 );
@@ -177,6 +254,10 @@ public:
   /// encoder estimation - inter prediction (non-skip)
 
   void setModeCtrl( EncModeCtrl *modeCtrl ) { m_modeCtrl = modeCtrl;}
+  void setCrossQpCache( CrossQpCache *cache ) { m_crossQpCache = cache; }
+  void setMotionFieldCache( const MotionFieldCache *cache ) { m_motionFieldCache = cache; }
+  void setGlobalMotion( const GlobalMotion *globalMotion ) { m_globalMotion = globalMotion; }
+  void setRefSubPelCache( RefSubPelCache *cache ) { m_refSubPelCache = cache; }
 
   void predInterSearch(CodingUnit& cu, Partitioner& partitioner );
 
@@ -346,6 +427,7 @@ protected:
 
 
   void xExtDIFUpSamplingH         ( CPelBuf* pcPattern );
+  bool xExtDIFUpSamplingHCached   ( CPelBuf* pcPattern, const Picture& refPic, const Position& pos );
   void xExtDIFUpSamplingQ         ( CPelBuf* pcPatternKey, Mv halfPelRef );
 
   // -------------------------------------------------------------------------------------------------------------------
@@ -53,10 +53,47 @@
  //! \ingroup EncoderLib
  //! \{
 
+IntraSatdCache::Entry& IntraSatdCache::get( const int poc, const uint32_t ctuAddr, const CompArea& area, const uint64_t signature, bool& reuse )
+{
+  const uint64_t key = ( uint64_t( area.x ) << 44 ) | ( uint64_t( area.y ) << 24 ) | ( uint64_t( area.width ) << 12 ) | uint64_t( area.height );
+
+  if( ctuAddr >= m_ctuEntries.size() )
+  {
+    m_ctuEntries.resize( ctuAddr + 1 );
+  }
+
+  std::vector<Entry>& entries = m_ctuEntries[ctuAddr];
+
+  if( entries.empty() )
+  {
+    entries.resize( size_t( 1 ) << m_log2NumEntriesPerCtu );
+
+    for( auto& e : entries )
+    {
+      e.key = std::numeric_limits<uint64_t>::max();
+    }
+  }
+
+  Entry& entry = entries[( key * 0x9e3779b97f4a7c15ull ) >> ( 64 - m_log2NumEntriesPerCtu )];
+
+  reuse = entry.key == key && entry.poc == poc && entry.signature == signature;
+
+  if( !reuse )
+  {
+    memset( entry.checked, 0, sizeof( entry.checked ) );
+    entry.key       = key;
+    entry.poc       = poc;
+    entry.signature = signature;
+  }
+
+  return entry;
+}
+
 IntraSearch::IntraSearch()
   : m_pSplitCS      (nullptr)
   , m_pFullCS       (nullptr)
   , m_pBestCS       (nullptr)
+  , m_useSatdCache  (false)
   , m_pcEncCfg      (nullptr)
   , m_pcTrQuant     (nullptr)
   , m_pcRdCost      (nullptr)
@@ -179,6 +216,7 @@ void IntraSearch::init( EncCfg*        pcEncCfg,
   m_pcRdCost                     = pcRdCost;
   m_CABACEstimator               = CABACEstimator;
   m_CtxCache                     = ctxCache;
+  m_useSatdCache                 = pcEncCfg->getUseIntraSatdCache() || pcEncCfg->getUseCrossQpReuse();
 
   const ChromaFormat cform = pcEncCfg->getChromaFormatIdc();
 
@@ -373,6 +411,16 @@ void IntraSearch::estIntraPredLumaQT( CodingUnit &cu, Partitioner &partitioner )
         bool bSatdChecked[NUM_INTRA_MODE];
         memset( bSatdChecked, 0, sizeof( bSatdChecked ) );
 
+        // the SATD of a prediction mode only depends on the reference samples, take it from an earlier visit of the
+        // block with the same neighbourhood (possibly in a pass at another QP) when possible
+        bool reuseSatd = false;
+        IntraSatdCache::Entry* satdCache = nullptr;
+
+        if( m_useSatdCache && bUseHadamard )
+        {
+          satdCache = &m_satdCache.get( cs.slice->getPOC(), getCtuAddr( area.lumaPos(), *cs.pcv ), area, xGetRefSampleSignature( area ), reuseSatd );
+        }
+
         {
           for( int modeIdx = 0; modeIdx < numModesAvailable; modeIdx++ )
           {
@@ -389,16 +437,29 @@ void IntraSearch::estIntraPredLumaQT( CodingUnit &cu, Partitioner &partitioner )
 
             pu.intraDir[0] = modeIdx;
 
-            if( useDPCMForFirstPassIntraEstimation( pu, uiMode ) )
+            if( reuseSatd && satdCache->checked[uiMode] )
             {
-              encPredIntraDPCM( COMPONENT_Y, piOrg, piPred, uiMode );
+              uiSad = satdCache->satd[uiMode];
             }
             else
             {
-              predIntraAng( COMPONENT_Y, piPred, pu, IntraPrediction::useFilteredIntraRefSamples( COMPONENT_Y, pu, true, pu ) );
+              if( useDPCMForFirstPassIntraEstimation( pu, uiMode ) )
+              {
+                encPredIntraDPCM( COMPONENT_Y, piOrg, piPred, uiMode );
+              }
+              else
+              {
+                predIntraAng( COMPONENT_Y, piPred, pu, IntraPrediction::useFilteredIntraRefSamples( COMPONENT_Y, pu, true, pu ) );
+              }
+              // use Hadamard transform here
+              uiSad += distParam.distFunc(distParam);
+
+              if( satdCache )
+              {
+                satdCache->checked[uiMode] = true;
+                satdCache->satd   [uiMode] = uiSad;
+              }
             }
-            // use Hadamard transform here
-            uiSad += distParam.distFunc(distParam);
 
             // NB xFracModeBitsIntra will not affect the mode for chroma that may have already been pre-estimated.
             m_CABACEstimator->getCtx() = SubCtx( Ctx::IPredMode[CHANNEL_TYPE_LUMA], ctxStartIntraMode );
@@ -434,17 +495,32 @@ void IntraSearch::estIntraPredLumaQT( CodingUnit &cu, Partitioner &partitioner )
               {
                 pu.intraDir[0] = mode;
 
-                if (useDPCMForFirstPassIntraEstimation(pu, mode))
+                Distortion sad = 0;
+
+                if (reuseSatd && satdCache->checked[mode])
                 {
-                  encPredIntraDPCM(COMPONENT_Y, piOrg, piPred, mode);
+                  sad = satdCache->satd[mode];
                 }
                 else
                 {
-                  predIntraAng(COMPONENT_Y, piPred, pu,
-                               IntraPrediction::useFilteredIntraRefSamples(COMPONENT_Y, pu, true, pu));
+                  if (useDPCMForFirstPassIntraEstimation(pu, mode))
+                  {
+                    encPredIntraDPCM(COMPONENT_Y, piOrg, piPred, mode);
+                  }
+                  else
+                  {
+                    predIntraAng(COMPONENT_Y, piPred, pu,
+                                 IntraPrediction::useFilteredIntraRefSamples(COMPONENT_Y, pu, true, pu));
+                  }
+                  // use Hadamard transform here
+                  sad = distParam.distFunc(distParam);
+
+                  if (satdCache)
+                  {
+                    satdCache->checked[mode] = true;
+                    satdCache->satd   [mode] = sad;
+                  }
                 }
-                // use Hadamard transform here
-                Distortion sad = distParam.distFunc(distParam);
 
                 // NB xFracModeBitsIntra will not affect the mode for chroma that may have already been pre-estimated.
                 m_CABACEstimator->getCtx() = SubCtx(Ctx::IPredMode[CHANNEL_TYPE_LUMA], ctxStartIntraMode);
@@ -701,7 +777,7 @@ void IntraSearch::estIntraPredChromaQT(CodingUnit &cu, Partitioner &partitioner)
         cs.addTU( CS::getArea( cs, partitioner.currArea(), partitioner.chType ), partitioner.chType );
       }
 
-      std::vector<TransformUnit*> orgTUs;
+      static_vector<TransformUnit*, MAX_NUM_PARTS_IN_CTU> orgTUs;
 
 
       // create a store for the TUs
@@ -819,6 +895,26 @@ void IntraSearch::IPCMSearch(CodingStructure &cs, Partitioner& partitioner)
   cs.picture->getRecoBuf(cs.area).copyFrom(cs.getRecoBuf());
 }
 
+uint64_t IntraSearch::xGetRefSampleSignature( const CompArea& area )
+{
+  const Pel* refBuf     = getPredictorPtr( area.compID );
+  const int  predStride = m_topRefLength + 1;
+
+  // FNV-1a over the above row (including the above-left sample) and the left column
+  uint64_t signature = 0xcbf29ce484222325ull;
+
+  for( int i = 0; i <= m_topRefLength; i++ )
+  {
+    signature = ( signature ^ uint16_t( refBuf[i] ) ) * 0x100000001b3ull;
+  }
+  for( int i = 1; i <= m_leftRefLength; i++ )
+  {
+    signature = ( signature ^ uint16_t( refBuf[i * predStride] ) ) * 0x100000001b3ull;
+  }
+
+  return signature;
+}
+
 void IntraSearch::xEncPCM(CodingStructure &cs, Partitioner& partitioner, const ComponentID &compID)
 {
   TransformUnit &tu = *cs.getTU( partitioner.chType );
@@ -1154,8 +1250,7 @@ void IntraSearch::xIntraCodingTUBlock(TransformUnit &tu, const ComponentID &comp
   //DTRACE_PEL_BUF( D_PRED, piPred, tu, tu.cu->predMode, COMPONENT_Y );
 
   //===== get residual signal =====
-  piResi.copyFrom( piOrg  );
-  piResi.subtract( piPred );
+  piResi.subtract( piOrg, piPred );
 
   if (pps.getPpsRangeExtension().getCrossComponentPredictionEnabledFlag() && isLuma(compID))
   {
@@ -1188,7 +1283,7 @@ void IntraSearch::xIntraCodingTUBlock(TransformUnit &tu, const ComponentID &comp
   if( transformIndex != DCT2_EMT && ( !tu.transformSkip[COMPONENT_Y] ) ) //this can only be true if compID is luma
   {
     *numSig = 0;
-    TCoeff* coeffBuffer = tu.getCoeffs(compID).buf;
+    TCoeffLevel* coeffBuffer = tu.getCoeffs(compID).buf;
     for( uint32_t uiX = 0; uiX < tu.Y().area(); uiX++ )
     {
       if( coeffBuffer[uiX] )
@@ -1220,25 +1315,25 @@ void IntraSearch::xIntraCodingTUBlock(TransformUnit &tu, const ComponentID &comp
     piResi.fill(0);
   }
 
-  //===== reconstruction =====
+  //===== cross component prediction =====
   if (bUseCrossCPrediction)
   {
     CrossComponentPrediction::crossComponentPrediction(tu, compID, cs.getResiBuf(tu.Y()), piResi, piResi, true);
   }
 
-  piReco.reconstruct(piPred, piResi, cs.slice->clpRng( compID ));
-
-  //===== update distortion =====
+  //===== reconstruction and distortion =====
 #if WCG_EXT
   if( m_pcEncCfg->getLumaLevelToDeltaQPMapping().isEnabled() )
   {
+    piReco.reconstruct(piPred, piResi, cs.slice->clpRng( compID ));
+
     const CPelBuf orgLuma = cs.getOrgBuf( cs.area.blocks[COMPONENT_Y] );
     ruiDist += m_pcRdCost->getDistPart( piOrg, piReco, bitDepth, compID, DF_SSE_WTD, &orgLuma );
   }
   else
 #endif
   {
-    ruiDist += m_pcRdCost->getDistPart( piOrg, piReco, bitDepth, compID, DF_SSE );
+    ruiDist += m_pcRdCost->getRecoDistPart( piReco, piPred, piResi, piOrg, cs.slice->clpRng( compID ), bitDepth, compID );
   }
 }
 
@@ -49,6 +49,8 @@
 #include "CommonLib/Unit.h"
 #include "CommonLib/RdCost.h"
 
+#include <vector>
+
 //! \ingroup EncoderLib
 //! \{
 
@@ -58,6 +60,36 @@
 
 class EncModeCtrl;
 
+/// Hadamard costs of the rough intra mode decision, kept per luma block of each CTU of the current picture
+/// an entry stays valid while the reference samples of the block are unchanged, so a block revisited through
+/// another split path, another QP of the MaxDeltaQP loop or another slice pass of DeltaQpRD only measures the modes
+/// that were not checked before
+class IntraSatdCache
+{
+public:
+
+  struct Entry
+  {
+    uint64_t   key;
+    int        poc;
+    uint64_t   signature;
+    bool       checked[NUM_LUMA_MODE];
+    Distortion satd   [NUM_LUMA_MODE];
+  };
+
+  // returns the entry of the block, reuse tells if its costs can be read (same picture and reference samples),
+  // otherwise the entry is emptied and assigned to the block, the picture and the signature
+  Entry& get    ( const int poc, const uint32_t ctuAddr, const CompArea& area, const uint64_t signature, bool& reuse );
+
+private:
+
+  // each CTU gets a direct-mapped table of fixed size on its first use, a block takes over the entry of
+  // another block hashed to the same slot, so neither the memory nor the allocations grow with the pictures
+  static const int m_log2NumEntriesPerCtu = 10;
+
+  std::vector<std::vector<Entry> > m_ctuEntries;
+};
+
 /// encoder search class
 class IntraSearch : public IntraPrediction, CrossComponentPrediction
 {
@@ -74,6 +106,9 @@ private:
 
   CodingStructure **m_pSaveCS;
 
+  IntraSatdCache   m_satdCache;
+  bool             m_useSatdCache;
+
   //cost variables for the EMT algorithm and new modes list
   double m_bestModeCostStore[4];                                    // RD cost of the best mode for each PU using DCT2
   double m_modeCostStore    [4][NUM_LUMA_MODE];                         // RD cost of each mode for each PU using DCT2
@@ -128,6 +163,9 @@ protected:
 
   void xEncPCM                    (CodingStructure &cs, Partitioner& partitioner, const ComponentID &compID);
 
+  /// hash of the unfiltered reference samples prepared by initIntraPatternChType
+  uint64_t xGetRefSampleSignature ( const CompArea& area );
+
   // -------------------------------------------------------------------------------------------------------------------
   // Intra search
   // -------------------------------------------------------------------------------------------------------------------
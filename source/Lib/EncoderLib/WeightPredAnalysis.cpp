@@ -98,6 +98,37 @@ void xCalcHistogram(const Pel  *pPel,
   }
 }
 
+//! restrict the areas of the original and the reference picture to their overlap when the reference is displaced by
+//! the global motion, so that the SAD measures the illumination change rather than the camera motion
+static
+void xAlignToGlobalMotion(const GlobalMotion *globalMotion,
+                          const Slice        *slice,
+                          const RefPicList    eRefPicList,
+                          const int           refIdx,
+                          const ComponentID   compID,
+                          const Pel          *&pOrg,
+                          const Pel          *&pRef,
+                          int                &width,
+                          int                &height,
+                          const int           orgStride,
+                          const int           refStride)
+{
+  int dx, dy;
+  if (globalMotion == nullptr || !globalMotion->getShift(*slice, eRefPicList, refIdx, dx, dy))
+  {
+    return;
+  }
+
+  const ChromaFormat chFmt = slice->getSPS()->getChromaFormatIdc();
+  dx = Clip3(-(width  - 1), width  - 1, dx >> ::getComponentScaleX(compID, chFmt));
+  dy = Clip3(-(height - 1), height - 1, dy >> ::getComponentScaleY(compID, chFmt));
+
+  pOrg   += std::max(0, -dy) * orgStride + std::max(0, -dx);
+  pRef   += std::max(0,  dy) * refStride + std::max(0,  dx);
+  width  -= abs(dx);
+  height -= abs(dy);
+}
+
 static
 Distortion xCalcHistDistortion (const std::vector<int> &histogram0,
                                 const std::vector<int> &histogram1)
@@ -223,6 +254,7 @@ Distortion xSearchHistogram(const std::vector<int> &histogramSource,
 // Member functions
 
 WeightPredAnalysis::WeightPredAnalysis()
+  : m_globalMotion(nullptr)
 {
   for ( uint32_t lst =0 ; lst<NUM_REF_PIC_LIST_01 ; lst++ )
   {
@@ -264,7 +296,18 @@ void WeightPredAnalysis::xCalcACDCParamSlice(Slice *const slice)
 
     const int sample = width*height;
 
+    // the global motion analysis has already gathered the histogram of the original picture
+    const std::vector<int> *histogram = m_globalMotion ? m_globalMotion->getHistogram(*slice->getPic(), compID) : nullptr;
+
     int64_t orgDC = 0;
+    if (histogram)
+    {
+      for(int v = 0; v < (int)histogram->size(); v++ )
+      {
+        orgDC += (int64_t)v * (*histogram)[v];
+      }
+    }
+    else
     {
       const Pel *pPel = compBuf.buf;
 
@@ -280,6 +323,14 @@ void WeightPredAnalysis::xCalcACDCParamSlice(Slice *const slice)
     const int64_t orgNormDC = ((orgDC+(sample>>1)) / sample);
 
     int64_t orgAC = 0;
+    if (histogram)
+    {
+      for(int v = 0; v < (int)histogram->size(); v++ )
+      {
+        orgAC += (int64_t)abs( v - (int)orgNormDC ) * (*histogram)[v];
+      }
+    }
+    else
     {
       const Pel *pPel = compBuf.buf;
 
@@ -508,12 +559,18 @@ bool WeightPredAnalysis::xSelectWPHistExtClip(Slice *const slice, const int log2
               int          offset     = wp.iOffset;
               int          weightDef  = defaultWeight;
               int          offsetDef  = 0;
+        const Pel         *pOrgMc     = pOrg;
+        const Pel         *pRefMc     = pRef;
+              int          widthMc    = width;
+              int          heightMc   = height;
+
+        xAlignToGlobalMotion(m_globalMotion, slice, eRefPicList, refIdxTemp, compID, pOrgMc, pRefMc, widthMc, heightMc, orgStride, refStride);
 
         // calculate SAD costs with/without wp for luma
-        const int64_t SADnoWP = xCalcSADvalueWPOptionalClip(bitDepth, pOrg, pRef, width, height, orgStride, refStride, log2Denom, defaultWeight, 0, useHighPrecision, bClipInitialSADWP);
+        const int64_t SADnoWP = xCalcSADvalueWPOptionalClip(bitDepth, pOrgMc, pRefMc, widthMc, heightMc, orgStride, refStride, log2Denom, defaultWeight, 0, useHighPrecision, bClipInitialSADWP);
         if (SADnoWP > 0)
         {
-          const int64_t SADWP   = xCalcSADvalueWPOptionalClip(bitDepth, pOrg, pRef, width, height, orgStride, refStride, log2Denom, weight,   offset, useHighPrecision, bClipInitialSADWP);
+          const int64_t SADWP   = xCalcSADvalueWPOptionalClip(bitDepth, pOrgMc, pRefMc, widthMc, heightMc, orgStride, refStride, log2Denom, weight,   offset, useHighPrecision, bClipInitialSADWP);
           const double dRatioSAD = (double)SADWP / (double)SADnoWP;
           double dRatioSr0SAD = std::numeric_limits<double>::max();
           double dRatioSrSAD  = std::numeric_limits<double>::max();
@@ -525,13 +582,21 @@ bool WeightPredAnalysis::xSelectWPHistExtClip(Slice *const slice, const int log2
             std::vector<int> searchedHistogram;
 
             // Compute histograms
-            xCalcHistogram(pOrg, histogramOrg, width, height, orgStride, 1 << bitDepth);
+            const std::vector<int> *histogramGlobalMotion = m_globalMotion ? m_globalMotion->getHistogram(*slice->getPic(), compID) : nullptr;
+            if (histogramGlobalMotion)
+            {
+              histogramOrg = *histogramGlobalMotion;
+            }
+            else
+            {
+              xCalcHistogram(pOrg, histogramOrg, width, height, orgStride, 1 << bitDepth);
+            }
             xCalcHistogram(pRef, histogramRef, width, height, refStride, 1 << bitDepth);
 
             // Do a histogram search around DC WP parameters; resulting distortion and 'searchedHistogram' is discarded
             xSearchHistogram(histogramOrg, histogramRef, searchedHistogram, bitDepth, log2Denom, weight, offset, useHighPrecision, compID);
             // calculate updated WP SAD
-            const int64_t SADSrWP = xCalcSADvalueWP(bitDepth, pOrg, pRef, width, height, orgStride, refStride, log2Denom, weight, offset, useHighPrecision);
+            const int64_t SADSrWP = xCalcSADvalueWP(bitDepth, pOrgMc, pRefMc, widthMc, heightMc, orgStride, refStride, log2Denom, weight, offset, useHighPrecision);
             dRatioSrSAD  = (double)SADSrWP  / (double)SADnoWP;
 
             if (bDoEnhancement)
@@ -539,7 +604,7 @@ bool WeightPredAnalysis::xSelectWPHistExtClip(Slice *const slice, const int log2
               // Do the same around the default ones; resulting distortion and 'searchedHistogram' is discarded
               xSearchHistogram(histogramOrg, histogramRef, searchedHistogram, bitDepth, log2Denom, weightDef, offsetDef, useHighPrecision, compID);
               // calculate updated WP SAD
-              const int64_t SADSr0WP = xCalcSADvalueWP(bitDepth, pOrg, pRef, width, height, orgStride, refStride, log2Denom, weightDef, offsetDef, useHighPrecision);
+              const int64_t SADSr0WP = xCalcSADvalueWP(bitDepth, pOrgMc, pRefMc, widthMc, heightMc, orgStride, refStride, log2Denom, weightDef, offsetDef, useHighPrecision);
               dRatioSr0SAD = (double)SADSr0WP / (double)SADnoWP;
             }
           }
@@ -622,10 +687,16 @@ bool WeightPredAnalysis::xSelectWP(Slice *const slice, const int log2Denom)
         const int          width      = compBuf.width;
         const int          height     = compBuf.height;
         const int          bitDepth   = slice->getSPS()->getBitDepth(toChannelType(compID));
+        const Pel         *pOrgMc     = pOrg;
+        const Pel         *pRefMc     = pRef;
+              int          widthMc    = width;
+              int          heightMc   = height;
+
+        xAlignToGlobalMotion(m_globalMotion, slice, eRefPicList, refIdxTemp, compID, pOrgMc, pRefMc, widthMc, heightMc, orgStride, refStride);
 
         // calculate SAD costs with/without wp for luma
-        SADWP   += xCalcSADvalueWP(bitDepth, pOrg, pRef, width, height, orgStride, refStride, log2Denom, m_wp[refList][refIdxTemp][compID].iWeight, m_wp[refList][refIdxTemp][compID].iOffset, useHighPrecisionPredictionWeighting);
-        SADnoWP += xCalcSADvalueWP(bitDepth, pOrg, pRef, width, height, orgStride, refStride, log2Denom, defaultWeight, 0, useHighPrecisionPredictionWeighting);
+        SADWP   += xCalcSADvalueWP(bitDepth, pOrgMc, pRefMc, widthMc, heightMc, orgStride, refStride, log2Denom, m_wp[refList][refIdxTemp][compID].iWeight, m_wp[refList][refIdxTemp][compID].iOffset, useHighPrecisionPredictionWeighting);
+        SADnoWP += xCalcSADvalueWP(bitDepth, pOrgMc, pRefMc, widthMc, heightMc, orgStride, refStride, log2Denom, defaultWeight, 0, useHighPrecisionPredictionWeighting);
       }
 
       const double dRatio     = SADnoWP > 0 ? (((double)SADWP / (double)SADnoWP)) : std::numeric_limits<double>::max();
@@ -40,6 +40,7 @@
 #include "../CommonLib/CommonDef.h"
 #include "../CommonLib/Slice.h"
 #include "VLCWriter.h"
+#include "EncGlobalMotion.h"
 
 class  WeightPredAnalysis
 {
@@ -47,6 +48,7 @@ private:
 
   // member variables
   WPScalingParam  m_wp[NUM_REF_PIC_LIST_01][MAX_NUM_REF][MAX_NUM_COMPONENT];
+  const GlobalMotion *m_globalMotion;
 
   // member functions
 
@@ -58,6 +60,8 @@ public:
 
   WeightPredAnalysis();
 
+  void  setGlobalMotion      (const GlobalMotion *globalMotion) { m_globalMotion = globalMotion; }
+
   // WP analysis :
   void  xCalcACDCParamSlice  (Slice *const slice);
   void  xEstimateWPParamSlice(Slice *const slice, const WeightedPredictionMethod method);
@@ -0,0 +1,96 @@
+/* The copyright in this software is being made available under the BSD
+* License, included below. This software may be subject to other third party
+* and contributor rights, including patent rights, and no such rights are
+* granted under this license.
+*
+* Copyright (c) 2010-2018, ITU/ISO/IEC
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*  * Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  * Redistributions in binary form must reproduce the above copyright notice,
+*    this list of conditions and the following disclaimer in the documentation
+*    and/or other materials provided with the distribution.
+*  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+*    be used to endorse or promote products derived from this software without
+*    specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/** \file     malloc_count.c
+ *  \brief    LD_PRELOAD library counting the heap allocations of a process
+ *
+ *  The counts are printed to stderr when the process exits, see malloc_count.sh.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+
+extern void* __libc_malloc  ( size_t size );
+extern void* __libc_calloc  ( size_t num, size_t size );
+extern void* __libc_realloc ( void* ptr, size_t size );
+extern void* __libc_memalign( size_t alignment, size_t size );
+
+static unsigned long s_numMalloc;
+static unsigned long s_numCalloc;
+static unsigned long s_numRealloc;
+static unsigned long s_numAligned;
+
+// operator new of libstdc++ allocates through malloc, so it is counted as well
+void* malloc( size_t size )
+{
+  __atomic_fetch_add( &s_numMalloc, 1, __ATOMIC_RELAXED );
+  return __libc_malloc( size );
+}
+
+void* calloc( size_t num, size_t size )
+{
+  __atomic_fetch_add( &s_numCalloc, 1, __ATOMIC_RELAXED );
+  return __libc_calloc( num, size );
+}
+
+void* realloc( void* ptr, size_t size )
+{
+  __atomic_fetch_add( &s_numRealloc, 1, __ATOMIC_RELAXED );
+  return __libc_realloc( ptr, size );
+}
+
+int posix_memalign( void** ptr, size_t alignment, size_t size )
+{
+  __atomic_fetch_add( &s_numAligned, 1, __ATOMIC_RELAXED );
+  *ptr = __libc_memalign( alignment, size );
+  return *ptr ? 0 : ENOMEM;
+}
+
+void* aligned_alloc( size_t alignment, size_t size )
+{
+  __atomic_fetch_add( &s_numAligned, 1, __ATOMIC_RELAXED );
+  return __libc_memalign( alignment, size );
+}
+
+void* memalign( size_t alignment, size_t size )
+{
+  __atomic_fetch_add( &s_numAligned, 1, __ATOMIC_RELAXED );
+  return __libc_memalign( alignment, size );
+}
+
+__attribute__( ( destructor ) ) static void printCounts( void )
+{
+  fprintf( stderr, "malloc_count: malloc %lu calloc %lu realloc %lu aligned %lu\n", s_numMalloc, s_numCalloc, s_numRealloc, s_numAligned );
+}
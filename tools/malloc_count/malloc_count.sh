@@ -0,0 +1,48 @@
+#!/bin/bash
+#
+# Counts the heap allocations the encoder makes per picture in steady state.
+#
+# The encoder is run twice, once coding FRAMES1 and once coding FRAMES2
+# pictures (FRAMES2 > FRAMES1), with the counting library of malloc_count.c
+# preloaded. The difference of the two counts divided by FRAMES2 - FRAMES1
+# leaves out the allocations of the start-up and of the first pictures.
+#
+# usage: malloc_count.sh <EncoderApp> <FRAMES1> <FRAMES2> [encoder options...]
+#
+# example:
+#   tools/malloc_count/malloc_count.sh bin/umake/gcc-12.2/x86_64/release/EncoderApp 4 8 \
+#     -c encoder_randomaccess.cfg -i in.yuv -wdt 256 -hgt 192 -fr 30 -q 32
+
+set -e -o pipefail
+
+if [ $# -lt 3 ]; then
+  echo "usage: $0 <EncoderApp> <FRAMES1> <FRAMES2> [encoder options...]" >&2
+  exit 1
+fi
+
+ENCODER=$1
+FRAMES1=$2
+FRAMES2=$3
+shift 3
+
+if [ "$FRAMES2" -le "$FRAMES1" ]; then
+  echo "FRAMES2 has to be larger than FRAMES1" >&2
+  exit 1
+fi
+
+TMPDIR=$(mktemp -d)
+trap 'rm -rf "$TMPDIR"' EXIT
+
+${CC:-cc} -O2 -shared -fPIC -o "$TMPDIR/malloc_count.so" "$(dirname "$0")/malloc_count.c"
+
+count()
+{
+  LD_PRELOAD="$TMPDIR/malloc_count.so" "$ENCODER" "$@" -b "$TMPDIR/str.bin" -o "" 2>&1 >/dev/null \
+    | awk '/^malloc_count:/ { print $3 + $5 + $7 + $9 }'
+}
+
+N1=$(count "$@" -f "$FRAMES1") || { echo "encoding $FRAMES1 pictures failed" >&2; exit 1; }
+N2=$(count "$@" -f "$FRAMES2") || { echo "encoding $FRAMES2 pictures failed" >&2; exit 1; }
+
+echo "allocations: $N1 for $FRAMES1 pictures, $N2 for $FRAMES2 pictures"
+echo "allocations per picture: $(( ( N2 - N1 ) / ( FRAMES2 - FRAMES1 ) ))"